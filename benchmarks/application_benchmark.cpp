@@ -609,6 +609,94 @@ static void BM_ConcurrentTaskExecution(benchmark::State& state) {
 }
 BENCHMARK(BM_ConcurrentTaskExecution)->Range(10, 1000)->Unit(benchmark::kMicrosecond);
 
+// Post-to-execution latency of a probe task queued behind a backlog,
+// covering the regression case where queue pressure stretches task
+// latency rather than throughput
+static void BM_PostTaskLatencyUnderPressure(benchmark::State& state) {
+    ensure_logger_initialized();
+
+    const int backlog_tasks = state.range(0);
+
+    auto app = std::make_unique<MinimalTestApp>();
+    app->start_app();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::atomic<int> drained{0};
+        for (int i = 0; i < backlog_tasks; ++i) {
+            app->post_task([&drained]() {
+                // Small fixed cost per backlog task so the probe really
+                // waits behind pending work
+                auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(5);
+                while (std::chrono::steady_clock::now() < end) {
+                }
+                drained.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+        state.ResumeTiming();
+
+        // Timed section: post the probe and wait for it to run
+        std::promise<void> probe_done;
+        auto probe_future = probe_done.get_future();
+        app->post_task([&probe_done]() { probe_done.set_value(); });
+        probe_future.wait();
+
+        state.PauseTiming();
+        while (drained.load() < backlog_tasks) {
+            std::this_thread::yield();
+        }
+        state.ResumeTiming();
+    }
+
+    app->stop_app();
+
+    state.counters["BacklogTasks"] = benchmark::Counter(backlog_tasks);
+}
+BENCHMARK(BM_PostTaskLatencyUnderPressure)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+// Multi-producer post_task contention: N threads post into one app,
+// contending on the priority lanes
+static void BM_PostTaskContention(benchmark::State& state) {
+    ensure_logger_initialized();
+
+    const int producer_threads = state.range(0);
+    constexpr int TASKS_PER_PRODUCER = 1000;
+
+    for (auto _ : state) {
+        auto app = std::make_unique<MultiThreadTestApp>(4);
+        app->start_app();
+
+        std::atomic<int> completed{0};
+
+        std::vector<std::thread> producers;
+        producers.reserve(producer_threads);
+        for (int p = 0; p < producer_threads; ++p) {
+            producers.emplace_back([&app, &completed]() {
+                for (int i = 0; i < TASKS_PER_PRODUCER; ++i) {
+                    app->post_task([&completed]() {
+                        completed.fetch_add(1, std::memory_order_relaxed);
+                    });
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        while (completed.load() < producer_threads * TASKS_PER_PRODUCER) {
+            std::this_thread::yield();
+        }
+
+        app->stop_app();
+    }
+
+    state.counters["Producers"] = benchmark::Counter(producer_threads);
+    state.counters["TasksPerSec"] = benchmark::Counter(
+        producer_threads * TASKS_PER_PRODUCER * state.iterations(),
+        benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_PostTaskContention)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
+
 // ============================================================================
 // Signal Handling and Error Resilience Benchmarks
 // ============================================================================
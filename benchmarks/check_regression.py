@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Benchmark regression gate.
+
+Runs one or more Google Benchmark binaries with JSON output and compares
+each benchmark's real time against a stored baseline. The run fails (exit
+code 1) when any benchmark is slower than its baseline by more than the
+allowed threshold, so a CI job wired to this script blocks performance
+regressions instead of just recording them.
+
+Usage:
+    check_regression.py [options] <benchmark_binary> [<benchmark_binary> ...]
+
+Typical flows:
+    # Record a baseline on a known-good build
+    check_regression.py --update-baseline ./messaging_benchmark ./table_benchmark
+
+    # Gate a candidate build against the stored baseline (default 15% slack)
+    check_regression.py ./messaging_benchmark ./table_benchmark
+
+Baselines are stored as the raw benchmark JSON, one file per binary, in
+the baseline directory (default: ./benchmark_baselines). Benchmarks that
+exist only in the current run (newly added) or only in the baseline
+(removed) are reported but do not fail the gate; re-run with
+--update-baseline after the suite changes shape.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+
+def run_benchmark(binary, extra_args):
+    """Run a benchmark binary and return its parsed JSON report."""
+    out_file = binary + ".regression.json"
+    cmd = [
+        binary,
+        "--benchmark_out=" + out_file,
+        "--benchmark_out_format=json",
+    ] + extra_args
+    print("Running: " + " ".join(cmd))
+    result = subprocess.run(cmd)
+    if result.returncode != 0:
+        raise RuntimeError(f"{binary} exited with code {result.returncode}")
+    with open(out_file) as f:
+        report = json.load(f)
+    os.remove(out_file)
+    return report
+
+
+def extract_timings(report):
+    """Map benchmark name -> real time in nanoseconds.
+
+    Aggregate rows (mean/median/stddev from --benchmark_repetitions) are
+    skipped so repetition runs compare individual iterations consistently
+    with single runs.
+    """
+    timings = {}
+    for bench in report.get("benchmarks", []):
+        if bench.get("run_type") == "aggregate":
+            continue
+        unit = bench.get("time_unit", "ns")
+        scale = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}[unit]
+        timings[bench["name"]] = bench["real_time"] * scale
+    return timings
+
+
+def baseline_path(baseline_dir, binary):
+    return os.path.join(baseline_dir, os.path.basename(binary) + ".baseline.json")
+
+
+def compare(binary, baseline, current, threshold):
+    """Compare one binary's run against its baseline.
+
+    Returns the list of regressed benchmark names.
+    """
+    regressions = []
+    for name in sorted(current):
+        if name not in baseline:
+            print(f"  NEW       {name} (no baseline entry)")
+            continue
+        base_ns = baseline[name]
+        cur_ns = current[name]
+        if base_ns <= 0:
+            continue
+        delta = (cur_ns - base_ns) / base_ns
+        status = "OK"
+        if delta > threshold:
+            status = "REGRESSED"
+            regressions.append(name)
+        print(f"  {status:<9} {name}: {base_ns:.0f}ns -> {cur_ns:.0f}ns "
+              f"({delta:+.1%}, limit +{threshold:.0%})")
+    for name in sorted(set(baseline) - set(current)):
+        print(f"  REMOVED   {name} (present in baseline only)")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare benchmark runs against stored baselines.")
+    parser.add_argument("binaries", nargs="+",
+                        help="benchmark executables to run")
+    parser.add_argument("--baseline-dir", default="benchmark_baselines",
+                        help="directory holding baseline JSON files "
+                             "(default: %(default)s)")
+    parser.add_argument("--threshold", type=float, default=0.15,
+                        help="allowed slowdown fraction before failing "
+                             "(default: %(default)s)")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="record this run as the new baseline instead "
+                             "of comparing")
+    parser.add_argument("--benchmark-filter", default=None,
+                        help="forwarded to the binaries as "
+                             "--benchmark_filter")
+    args = parser.parse_args()
+
+    extra_args = []
+    if args.benchmark_filter:
+        extra_args.append("--benchmark_filter=" + args.benchmark_filter)
+
+    os.makedirs(args.baseline_dir, exist_ok=True)
+
+    all_regressions = []
+    missing_baselines = []
+    for binary in args.binaries:
+        report = run_benchmark(binary, extra_args)
+        path = baseline_path(args.baseline_dir, binary)
+
+        if args.update_baseline:
+            with open(path, "w") as f:
+                json.dump(report, f, indent=2)
+            print(f"Baseline updated: {path}")
+            continue
+
+        if not os.path.exists(path):
+            missing_baselines.append(binary)
+            print(f"No baseline for {binary}; run with --update-baseline "
+                  f"to record one ({path})")
+            continue
+
+        with open(path) as f:
+            baseline = extract_timings(json.load(f))
+        current = extract_timings(report)
+
+        print(f"Comparing {binary} against {path}:")
+        regressed = compare(binary, baseline, current, args.threshold)
+        all_regressions.extend((binary, name) for name in regressed)
+
+    if args.update_baseline:
+        return 0
+
+    if all_regressions:
+        print(f"\nFAIL: {len(all_regressions)} benchmark(s) regressed beyond "
+              f"+{args.threshold:.0%}:")
+        for binary, name in all_regressions:
+            print(f"  {os.path.basename(binary)}: {name}")
+        return 1
+
+    if missing_baselines:
+        print("\nWARN: no baselines recorded for: "
+              + ", ".join(missing_baselines))
+    print("\nPASS: no benchmark regressed beyond the threshold")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,253 @@
+/*
+ * @file messaging_benchmark.cpp
+ * @brief Benchmarks for the inter-thread messaging hot paths
+ *
+ * Covers the dynamic send_message path (including multi-producer fan-in
+ * contention), the statically-typed channel fast path, and the batched
+ * MPSC channel, so throughput regressions in message delivery show up
+ * in the regression run instead of in production.
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <benchmark/benchmark.h>
+#include "benchmark_adapter.h"
+#include <thread_messaging.h>
+#include <logger.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace base;
+using namespace base::benchmark_adapter;
+
+namespace {
+
+struct BenchMessage {
+    std::uint64_t sequence;
+    std::uint64_t payload;
+};
+
+// Consumer event loop shared by the benchmarks: one io_context run by a
+// dedicated thread, mirroring how a ManagedThread hosts its context
+class ConsumerLoop {
+public:
+    ConsumerLoop()
+        : work_guard_(asio::make_work_guard(io_context_)),
+          context_(std::make_shared<ThreadMessagingContext>("bench_consumer", io_context_)),
+          thread_([this]() { io_context_.run(); }) {
+        context_->start();
+    }
+
+    ~ConsumerLoop() {
+        context_->stop();
+        work_guard_.reset();
+        io_context_.stop();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    ThreadMessagingContext& context() { return *context_; }
+    std::shared_ptr<ThreadMessagingContext> context_ptr() { return context_; }
+
+private:
+    asio::io_context io_context_;
+    asio::executor_work_guard<asio::io_context::executor_type> work_guard_;
+    std::shared_ptr<ThreadMessagingContext> context_;
+    std::thread thread_;
+};
+
+void ensure_quiet_logger() {
+    static bool initialized = false;
+    if (!initialized) {
+        LoggerConfig config;
+        config.level = LogLevel::Error;
+        config.enable_console = false;
+        Logger::init(config);
+        initialized = true;
+    }
+}
+
+void wait_for(const std::atomic<std::uint64_t>& delivered, std::uint64_t expected) {
+    while (delivered.load(std::memory_order_acquire) < expected) {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// Dynamic send_message path
+// ============================================================================
+
+static void BM_MessageSendThroughput(benchmark::State& state) {
+    ensure_quiet_logger();
+    const auto messages = static_cast<std::uint64_t>(state.range(0));
+
+    ConsumerLoop loop;
+    std::atomic<std::uint64_t> delivered{0};
+    loop.context().subscribe<BenchMessage>([&delivered](const BenchMessage&) {
+        delivered.fetch_add(1, std::memory_order_release);
+    });
+
+    for (auto _ : state) {
+        const auto base_count = delivered.load(std::memory_order_acquire);
+        for (std::uint64_t i = 0; i < messages; ++i) {
+            loop.context().send_message(BenchMessage{i, i * 2});
+        }
+        wait_for(delivered, base_count + messages);
+    }
+
+    TableMetrics::add_throughput_metrics(state, messages * state.iterations(),
+                                         messages * sizeof(BenchMessage));
+}
+BENCHMARK(BM_MessageSendThroughput)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+// Multi-producer fan-in: N producer threads hammer one consumer context,
+// contending on the lane mutex and the delivery pump
+static void BM_MessageFanInContention(benchmark::State& state) {
+    ensure_quiet_logger();
+    const auto producers = static_cast<std::size_t>(state.range(0));
+    constexpr std::uint64_t MESSAGES_PER_PRODUCER = 2000;
+
+    ConsumerLoop loop;
+    std::atomic<std::uint64_t> delivered{0};
+    loop.context().subscribe<BenchMessage>([&delivered](const BenchMessage&) {
+        delivered.fetch_add(1, std::memory_order_release);
+    });
+
+    for (auto _ : state) {
+        const auto base_count = delivered.load(std::memory_order_acquire);
+
+        std::vector<std::thread> threads;
+        threads.reserve(producers);
+        for (std::size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&loop, p]() {
+                for (std::uint64_t i = 0; i < MESSAGES_PER_PRODUCER; ++i) {
+                    loop.context().send_message(BenchMessage{i, p});
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        wait_for(delivered, base_count + producers * MESSAGES_PER_PRODUCER);
+    }
+
+    state.counters["Producers"] = benchmark::Counter(static_cast<double>(producers));
+    TableMetrics::add_throughput_metrics(
+        state, producers * MESSAGES_PER_PRODUCER * state.iterations());
+}
+BENCHMARK(BM_MessageFanInContention)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Typed and batched channel fast paths
+// ============================================================================
+
+static void BM_TypedChannelSend(benchmark::State& state) {
+    ensure_quiet_logger();
+    const auto messages = static_cast<std::uint64_t>(state.range(0));
+
+    ConsumerLoop loop;
+    std::atomic<std::uint64_t> delivered{0};
+    auto channel = loop.context().open_channel<BenchMessage>(
+        [&delivered](const BenchMessage&) {
+            delivered.fetch_add(1, std::memory_order_release);
+        });
+
+    for (auto _ : state) {
+        const auto base_count = delivered.load(std::memory_order_acquire);
+        for (std::uint64_t i = 0; i < messages; ++i) {
+            channel->send(BenchMessage{i, i});
+        }
+        wait_for(delivered, base_count + messages);
+    }
+
+    TableMetrics::add_throughput_metrics(state, messages * state.iterations());
+}
+BENCHMARK(BM_TypedChannelSend)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+static void BM_BatchedChannelFanIn(benchmark::State& state) {
+    ensure_quiet_logger();
+    const auto producers = static_cast<std::size_t>(state.range(0));
+    constexpr std::uint64_t MESSAGES_PER_PRODUCER = 2000;
+
+    ConsumerLoop loop;
+    std::atomic<std::uint64_t> delivered{0};
+    auto channel = loop.context_ptr()->open_batched_channel<BenchMessage>(
+        [&delivered](const BenchMessage&) {
+            delivered.fetch_add(1, std::memory_order_release);
+        });
+
+    for (auto _ : state) {
+        const auto base_count = delivered.load(std::memory_order_acquire);
+
+        std::vector<std::thread> threads;
+        threads.reserve(producers);
+        for (std::size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&channel, p]() {
+                for (std::uint64_t i = 0; i < MESSAGES_PER_PRODUCER; ++i) {
+                    // Ring full is the backpressure signal; retry like a
+                    // real high-rate producer would
+                    while (!channel->try_send(BenchMessage{i, p})) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        wait_for(delivered, base_count + producers * MESSAGES_PER_PRODUCER);
+    }
+
+    state.counters["Producers"] = benchmark::Counter(static_cast<double>(producers));
+    TableMetrics::add_throughput_metrics(
+        state, producers * MESSAGES_PER_PRODUCER * state.iterations());
+}
+BENCHMARK(BM_BatchedChannelFanIn)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
+
+// Profile-scaled variants for the regression run: the adapter's scale
+// factor sizes the burst, so Quick stays sub-second while Performance
+// exercises a sustained stream through one shared helper
+namespace {
+
+void run_scaled_send(benchmark::State& state, Profile profile) {
+    ensure_quiet_logger();
+    const auto messages =
+        static_cast<std::uint64_t>(ProfileManager::get_scale_factor(profile));
+
+    ConsumerLoop loop;
+    std::atomic<std::uint64_t> delivered{0};
+    loop.context().subscribe<BenchMessage>([&delivered](const BenchMessage&) {
+        delivered.fetch_add(1, std::memory_order_release);
+    });
+
+    for (auto _ : state) {
+        const auto base_count = delivered.load(std::memory_order_acquire);
+        for (std::uint64_t i = 0; i < messages; ++i) {
+            loop.context().send_message(BenchMessage{i, i});
+        }
+        wait_for(delivered, base_count + messages);
+    }
+
+    TableMetrics::add_throughput_metrics(state, messages * state.iterations());
+}
+
+} // namespace
+
+BENCHMARK_PROFILE(MessagingSendScaled, Quick) {
+    run_scaled_send(state, Profile::Quick);
+}
+
+BENCHMARK_PROFILE(MessagingSendScaled, Development) {
+    run_scaled_send(state, Profile::Development);
+}
+
+BENCHMARK_MAIN();
@@ -388,6 +388,51 @@ static void BM_TableComplexQuery(benchmark::State& state) {
 }
 
 // Concurrent access benchmark
+// Indexed query throughput with N reader threads contending on the
+// shared table and index locks
+static void BM_TableIndexedQueryContention(benchmark::State& state) {
+    auto reader_threads = state.range(0);
+    constexpr size_t TABLE_ROWS = 10000;
+    constexpr size_t QUERIES_PER_READER = 1000;
+
+    auto& data = TableTestData::instance();
+    auto table = data.createEmployeeTable();
+    table->enable_concurrent_access(true);
+
+    for (size_t i = 1; i <= TABLE_ROWS; ++i) {
+        auto row_data = data.generateEmployeeRow(static_cast<int64_t>(i));
+        table->insert_row(row_data);
+    }
+    table->create_index("idx_department", {"department"});
+
+    std::vector<std::string> departments = {
+        "Engineering", "Sales", "Marketing", "HR", "Finance", "Operations", "Support"
+    };
+
+    for (auto _ : state) {
+        std::vector<std::thread> readers;
+        readers.reserve(reader_threads);
+        for (int64_t t = 0; t < reader_threads; ++t) {
+            readers.emplace_back([&table, &departments, t]() {
+                for (size_t i = 0; i < QUERIES_PER_READER; ++i) {
+                    const auto& dept = departments[(t + i) % departments.size()];
+                    auto rows = table->find_by_index("idx_department", {dept});
+                    benchmark::DoNotOptimize(rows);
+                }
+            });
+        }
+        for (auto& reader : readers) {
+            reader.join();
+        }
+    }
+
+    state.counters["Readers"] = benchmark::Counter(reader_threads);
+    state.counters["TableRows"] = benchmark::Counter(TABLE_ROWS);
+    state.counters["QueriesPerSec"] = benchmark::Counter(
+        reader_threads * QUERIES_PER_READER * state.iterations(),
+        benchmark::Counter::kIsRate);
+}
+
 static void BM_TableConcurrentAccess(benchmark::State& state) {
     auto scale = state.range(0);
     auto& data = TableTestData::instance();
@@ -836,6 +881,7 @@ BENCHMARK(BM_TableUpdate)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_TableDelete)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_TableIndexCreation)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_TableIndexQuery)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TableIndexedQueryContention)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_TableClone)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_TableJsonSerialization)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_TableJsonDeserialization)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
@@ -12,12 +12,17 @@
 #include "config.h"
 #include "cli.h"
 #include "thread_messaging.h"
+#include "timer_wheel.h"
 
 #include <asio.hpp>
 #include <asio/signal_set.hpp>
 
+#include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
+#include <cstdint>
+#include <deque>
 #include <future>
 #include <functional>
 #include <memory>
@@ -67,6 +72,8 @@ struct ApplicationConfig {
 
     // Threading configuration
     std::size_t worker_threads = std::jthread::hardware_concurrency();
+    bool enable_work_stealing = false;  ///< Per-worker run queues with idle-worker stealing for Normal tasks
+    std::chrono::milliseconds slow_task_threshold{100};  ///< Executions at or above this are counted and logged as slow
 
     // Signal handling
     std::vector<int> handled_signals = {SIGINT, SIGTERM, SIGHUP, SIGUSR1, SIGUSR2};
@@ -113,12 +120,123 @@ struct ApplicationConfig {
  * All priorities maintain full exception safety for application reliability.
  */
 enum class TaskPriority {
-    Low = 0,        ///< Low priority: Queued execution, explicit low importance
-    Normal = 1,     ///< Normal priority: Queued execution, default for most tasks
-    High = 2,       ///< High priority: Immediate dispatch, time-sensitive operations
-    Critical = 3    ///< Critical priority: Immediate dispatch, highest urgency
+    Low = 0,        ///< Low priority: drained last, protected from starvation
+    Normal = 1,     ///< Normal priority: default for most tasks
+    High = 2,       ///< High priority: drained before Normal/Low work
+    Critical = 3    ///< Critical priority: highest urgency, drained first
 };
 
+/**
+ * @brief Snapshot of task scheduling instrumentation
+ *
+ * Mirrors the Table::Statistics pattern: a plain struct copied out of
+ * relaxed atomic counters, queryable at any time without pausing the
+ * event loop. Wait times measure enqueue-to-run latency; the histogram
+ * buckets are powers of two in microseconds (bucket i covers
+ * [2^i, 2^(i+1)) µs, with the last bucket open-ended).
+ */
+struct TaskStatistics {
+    static constexpr std::size_t PRIORITY_COUNT = 4;
+    static constexpr std::size_t LATENCY_BUCKET_COUNT = 16;
+
+    std::array<std::uint64_t, PRIORITY_COUNT> posted{};    ///< Tasks posted, per TaskPriority
+    std::array<std::uint64_t, PRIORITY_COUNT> executed{};  ///< Tasks completed, per TaskPriority
+    std::uint64_t queue_depth{0};                          ///< Tasks posted but not yet run
+    std::uint64_t slow_tasks{0};                           ///< Executions over the slow-task threshold
+    std::uint64_t total_wait_us{0};                        ///< Sum of enqueue-to-run latencies
+    std::uint64_t max_wait_us{0};                          ///< Worst enqueue-to-run latency seen
+    std::array<std::uint64_t, LATENCY_BUCKET_COUNT> wait_histogram{};  ///< Latency distribution
+};
+
+/**
+ * @brief Always-on task instrumentation shared by Application and ManagedThread
+ *
+ * All counters are relaxed atomics, so the posting and execution hot
+ * paths pay a handful of uncontended increments plus two steady_clock
+ * reads per task. Executions at or above the slow-task threshold are
+ * counted and logged with their duration.
+ */
+class TaskInstrumentation {
+public:
+    void record_post(std::size_t lane) noexcept {
+        posted_[lane].fetch_add(1, std::memory_order_relaxed);
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_run(std::size_t lane,
+                    std::chrono::steady_clock::time_point enqueued,
+                    std::chrono::steady_clock::time_point start,
+                    std::chrono::steady_clock::time_point end,
+                    std::chrono::milliseconds slow_threshold,
+                    std::string_view owner) noexcept {
+        executed_[lane].fetch_add(1, std::memory_order_relaxed);
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+
+        auto wait_us = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(start - enqueued).count());
+        total_wait_us_.fetch_add(wait_us, std::memory_order_relaxed);
+
+        auto previous_max = max_wait_us_.load(std::memory_order_relaxed);
+        while (wait_us > previous_max &&
+               !max_wait_us_.compare_exchange_weak(previous_max, wait_us,
+                                                   std::memory_order_relaxed)) {
+        }
+
+        auto bucket = wait_us == 0
+                          ? std::size_t{0}
+                          : std::min<std::size_t>(std::bit_width(wait_us) - 1,
+                                                  TaskStatistics::LATENCY_BUCKET_COUNT - 1);
+        wait_histogram_[bucket].fetch_add(1, std::memory_order_relaxed);
+
+        auto execution = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        if (execution >= slow_threshold) {
+            slow_tasks_.fetch_add(1, std::memory_order_relaxed);
+            Logger::warn("Slow task on {}: ran for {}ms (threshold {}ms)",
+                         owner, execution.count(), slow_threshold.count());
+        }
+    }
+
+    TaskStatistics snapshot() const noexcept {
+        TaskStatistics stats;
+        for (std::size_t i = 0; i < TaskStatistics::PRIORITY_COUNT; ++i) {
+            stats.posted[i] = posted_[i].load(std::memory_order_relaxed);
+            stats.executed[i] = executed_[i].load(std::memory_order_relaxed);
+        }
+        stats.queue_depth = pending_.load(std::memory_order_relaxed);
+        stats.slow_tasks = slow_tasks_.load(std::memory_order_relaxed);
+        stats.total_wait_us = total_wait_us_.load(std::memory_order_relaxed);
+        stats.max_wait_us = max_wait_us_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < TaskStatistics::LATENCY_BUCKET_COUNT; ++i) {
+            stats.wait_histogram[i] = wait_histogram_[i].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, TaskStatistics::PRIORITY_COUNT> posted_{};
+    std::array<std::atomic<std::uint64_t>, TaskStatistics::PRIORITY_COUNT> executed_{};
+    std::atomic<std::uint64_t> pending_{0};
+    std::atomic<std::uint64_t> slow_tasks_{0};
+    std::atomic<std::uint64_t> total_wait_us_{0};
+    std::atomic<std::uint64_t> max_wait_us_{0};
+    std::array<std::atomic<std::uint64_t>, TaskStatistics::LATENCY_BUCKET_COUNT> wait_histogram_{};
+};
+
+/**
+ * @brief Awaitable delay for use inside coroutines
+ * @param duration Time to suspend the awaiting coroutine
+ *
+ * Suspends on a timer bound to the awaiting coroutine's executor, so it
+ * works unchanged in Application and ManagedThread coroutines:
+ * @code
+ * co_await async_delay(std::chrono::milliseconds(100));
+ * @endcode
+ */
+inline asio::awaitable<void> async_delay(std::chrono::milliseconds duration) {
+    asio::steady_timer timer(co_await asio::this_coro::executor, duration);
+    co_await timer.async_wait(asio::use_awaitable);
+}
+
 /**
  * @brief Forward declarations
  */
@@ -195,6 +313,20 @@ public:
      */
     virtual std::string_view name() const = 0;
 
+    /**
+     * @brief Names of components that must be ready before this one
+     *
+     * Startup initializes and starts components in dependency waves:
+     * components whose dependencies are all satisfied run their phase
+     * concurrently, and the next wave begins once the whole wave
+     * completed. Shutdown stops the waves in reverse, so dependents stop
+     * before their dependencies. A dependency on an unregistered name is
+     * logged and ignored; a dependency cycle fails initialization.
+     *
+     * Default: no dependencies (eligible for the first wave).
+     */
+    virtual std::vector<std::string_view> dependencies() const { return {}; }
+
     /**
      * @brief Health check for the component
      * @return true if component is healthy
@@ -327,24 +459,38 @@ public:
     asio::any_io_executor executor() noexcept { return io_context_.get_executor(); }
 
     /**
-     * @brief Post a task to the event loop with priority-based scheduling optimization
+     * @brief Get the application's timer wheel
+     *
+     * All delayed and recurring tasks share this wheel, so scheduling
+     * tens of thousands of fine-grained timers adds map entries rather
+     * than asio timer objects. Components may schedule directly on it
+     * when they need O(1) insert/cancel without priority-lane routing.
+     */
+    TimerWheel& timer_wheel() noexcept { return timer_wheel_; }
+
+    /**
+     * @brief Post a task to the event loop with multi-level priority scheduling
      * @param task Task function to execute
-     * @param priority Task execution priority:
-     *                 - Critical: Immediate execution using dispatch (highest priority)
-     *                 - High: Immediate execution using dispatch (high priority)
-     *                 - Normal: Queued execution using post (default, balanced)
-     *                 - Low: Queued execution using post (explicitly lower priority)
+     * @param priority Task execution priority selecting the lane the task
+     *                 is queued in (Critical > High > Normal > Low)
+     *
+     * Tasks are staged in per-priority lanes in front of the io_context_.
+     * Each worker invocation drains the most urgent lane first, so a
+     * Critical task posted while thousands of Normal tasks are pending
+     * runs next rather than waiting its turn in FIFO order. The Low lane
+     * is protected from starvation: after a bounded number of consecutive
+     * higher-priority picks the oldest Low task is serviced regardless.
      *
-     * @note All priorities maintain full exception safety for application stability.
-     *       Priority affects WHEN a task executes, not HOW safely it executes.
-     *       - dispatch: Executes immediately if called from event loop, otherwise queues
-     *       - post: Always queues for execution in event loop order
+     * @note All priorities maintain full exception safety for application
+     *       stability. Priority affects WHEN a task executes, not HOW
+     *       safely it executes. Tasks within the same lane run in FIFO
+     *       order.
      *
      * @example
      * // Safe execution with default priority
      * app.post_task([]{ do_work(); });
      *
-     * // High-priority execution (immediate dispatch)
+     * // High-priority execution (drained before Normal/Low work)
      * app.post_task([]{ urgent_work(); }, TaskPriority::High);
      *
      * // Critical priority for time-sensitive operations
@@ -352,6 +498,34 @@ public:
      */
     void post_task(TaskFunction task, TaskPriority priority = TaskPriority::Normal);
 
+    /**
+     * @brief Spawn a C++20 coroutine on the application's event loop
+     * @param task Awaitable to run to completion
+     *
+     * Multi-step pipelines can run as a single coroutine frame instead of
+     * a chain of type-erased post_task closures; each co_await suspends
+     * without re-entering the task queue. Exceptions escaping the
+     * coroutine are logged, matching post_task's exception guard.
+     *
+     * @example
+     * app.co_spawn([](Application& app) -> asio::awaitable<void> {
+     *     auto data = co_await fetch();
+     *     co_await async_delay(std::chrono::milliseconds(100));
+     *     process(data);
+     * }(app));
+     */
+    void co_spawn(asio::awaitable<void> task);
+
+    /**
+     * @brief Snapshot of the event loop's task instrumentation
+     *
+     * Per-priority posted/executed counters, current queue depth,
+     * enqueue-to-run latency histogram, and slow-task count (threshold
+     * set by ApplicationConfig::slow_task_threshold). Safe to call from
+     * any thread at any time.
+     */
+    TaskStatistics task_statistics() const { return task_instrumentation_.snapshot(); }
+
     /**
      * @brief Post a delayed task to the event loop
      * @param task Task function to execute
@@ -425,6 +599,26 @@ public:
      */
     bool reload_config();
 
+    /**
+     * @brief Start watching the loaded config file for changes
+     * @param poll_interval How often to check the file's modification time
+     *
+     * Schedules a recurring task on the event loop that polls
+     * ConfigManager::poll_file_changes(). When the file changes on disk
+     * the configuration is re-parsed and diffed, and only the keys that
+     * actually changed are pushed to ConfigManager::subscribe_changes
+     * subscribers — no restart or stop-the-world reconfigure. Combined
+     * with the change subscription this lets thread counts, log levels
+     * (via configure_logger) and cache sizes be retuned under load.
+     */
+    void enable_config_hot_reload(
+        std::chrono::milliseconds poll_interval = std::chrono::milliseconds(1000));
+
+    /**
+     * @brief Stop watching the config file for changes
+     */
+    void disable_config_hot_reload();
+
     // Thread Management API
 
     /**
@@ -455,6 +649,15 @@ public:
          */
         asio::any_io_executor executor() noexcept { return io_context_.get_executor(); }
 
+        /**
+         * @brief Get the thread's timer wheel
+         *
+         * All of this thread's delayed and recurring work shares one
+         * wheel, so adding timers does not add asio timer objects or
+         * per-tick allocations.
+         */
+        TimerWheel& timer_wheel() noexcept { return timer_wheel_; }
+
         /**
          * @brief Get thread name
          */
@@ -480,6 +683,23 @@ public:
          */
         void post_task(std::function<void()> task);
 
+        /**
+         * @brief Spawn a C++20 coroutine on this thread's event loop
+         * @param task Awaitable to run to completion
+         *
+         * Exceptions escaping the coroutine are logged, matching
+         * post_task's exception guard.
+         */
+        void co_spawn(asio::awaitable<void> task);
+
+        /**
+         * @brief Snapshot of this thread's task instrumentation
+         *
+         * ManagedThread has a single implicit Normal lane; the slow-task
+         * threshold is the framework default of 100ms.
+         */
+        TaskStatistics task_statistics() const { return task_instrumentation_.snapshot(); }
+
         /**
          * @brief Send a typed message to this thread (wakes up thread immediately)
          */
@@ -517,6 +737,8 @@ public:
         const std::string name_;
         const ThreadFunction func_;
         asio::io_context io_context_;
+        TimerWheel timer_wheel_{io_context_};
+        TaskInstrumentation task_instrumentation_;
         std::unique_ptr<asio::executor_work_guard<asio::io_context::executor_type>> work_guard_;
         std::shared_ptr<ThreadMessagingContext> messaging_context_;
         std::jthread thread_;  // Last member - destructor auto-joins
@@ -676,17 +898,51 @@ private:
     // Component management
     std::vector<std::unique_ptr<ApplicationComponent>> components_;
 
-    // Task scheduling
+    // Task scheduling: delayed and recurring tasks are multiplexed onto
+    // one hashed timer wheel instead of a steady_timer per task
+    TimerWheel timer_wheel_{io_context_};
     struct RecurringTask {
         std::size_t id;
-        std::shared_ptr<asio::steady_timer> timer;
-        TaskFunction function;
-        std::chrono::milliseconds interval;
+        TimerWheel::TimerId wheel_id;
         TaskPriority priority;
     };
     std::vector<RecurringTask> recurring_tasks_;
     std::atomic<std::size_t> next_task_id_{1};
 
+    // Recurring task id of the config file watcher (0 = not enabled)
+    std::size_t config_watch_task_id_{0};
+
+    // Multi-level priority lanes drained highest-first in front of the
+    // io_context_. post_task() enqueues into the lane matching the task's
+    // priority and posts one pump invocation; each pump pops the most
+    // urgent pending task, with a starvation guard that services the Low
+    // lane after LOW_LANE_STARVATION_LIMIT consecutive higher picks.
+    static constexpr std::size_t TASK_LANE_COUNT = 4;
+    static constexpr std::size_t LOW_LANE_STARVATION_LIMIT = 16;
+    struct QueuedTask {
+        TaskFunction function;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+    std::array<std::deque<QueuedTask>, TASK_LANE_COUNT> task_lanes_;
+    std::size_t low_lane_passes_{0};
+    mutable std::mutex task_lanes_mutex_;
+    TaskInstrumentation task_instrumentation_;
+
+    // Work-stealing mode (config_.enable_work_stealing): Normal-priority
+    // tasks go to per-worker local queues instead of the shared io_context
+    // queue; the owner pops from the front, idle workers steal from the
+    // back. Critical/High/Low still flow through the priority lanes, which
+    // every worker drains ahead of local work, so lane ordering guarantees
+    // are preserved for non-default priorities.
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<QueuedTask> tasks;
+    };
+    static constexpr std::size_t INVALID_WORKER_INDEX = static_cast<std::size_t>(-1);
+    static thread_local std::size_t worker_index_;
+    std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+    std::atomic<std::size_t> next_worker_queue_{0};
+
     // Signal and error handling
     std::map<int, SignalHandler> signal_handlers_;
     ErrorHandler error_handler_;
@@ -719,7 +975,15 @@ private:
     void start_health_monitoring();
     void stop_health_monitoring();
     void perform_health_check();
-    void execute_recurring_task(std::shared_ptr<RecurringTask> task);
+    void run_next_prioritized_task();
+    void run_work_stealing_worker(std::size_t index, std::stop_token stop_token);
+    bool try_run_worker_task(std::size_t index);
+
+    // Component dependency scheduling (callers hold components_mutex_)
+    std::vector<std::vector<ApplicationComponent*>> component_dependency_waves(bool& ok) const;
+    bool run_component_phase(const std::vector<ApplicationComponent*>& wave,
+                             std::string_view phase,
+                             const std::function<bool(ApplicationComponent&)>& action);
     void change_state(ApplicationState new_state);
     void handle_exception(const std::exception& e);
 
@@ -950,40 +1214,46 @@ protected:
      * @param callback Function to execute
      * @return Timer ID for cancellation, or 0 if component not running
      */
+    /**
+     * @brief Spawn a C++20 coroutine on this component's thread
+     * @param task Awaitable to run to completion
+     * @return true if the coroutine was spawned (component thread running)
+     *
+     * Periodic work can be written as a loop over async_delay() instead
+     * of a schedule_timer callback:
+     * @code
+     * co_spawn([this]() -> asio::awaitable<void> {
+     *     while (!stop_requested()) {
+     *         co_await async_delay(interval_);
+     *         poll_backend();
+     *     }
+     * }());
+     * @endcode
+     */
+    bool co_spawn(asio::awaitable<void> task) {
+        auto concrete_thread = concrete_managed_thread();
+        if (!concrete_thread) {
+            return false;
+        }
+        concrete_thread->co_spawn(std::move(task));
+        return true;
+    }
+
     std::size_t schedule_timer(std::chrono::milliseconds interval, std::function<void()> callback) {
         auto concrete_thread = concrete_managed_thread();
         if (!concrete_thread) {
             return 0;
         }
 
-        auto timer_id = next_timer_id_++;
-        auto timer = std::make_shared<asio::steady_timer>(concrete_thread->io_context());
-
-        timers_[timer_id] = timer;
-
-        // Use a shared_ptr to the recursive function to avoid capture issues
-        auto schedule_func = std::make_shared<std::function<void()>>();
-        *schedule_func = [this, timer, interval, callback, timer_id, schedule_func]() {
-            if (!running_.load() || timers_.find(timer_id) == timers_.end()) {
-                return; // Timer was cancelled or component stopped
-            }
-
-            timer->expires_after(interval);
-            timer->async_wait([this, callback, schedule_func](const asio::error_code& ec) {
-                if (!ec && running_.load()) {
-                    try {
-                        callback();
-                    } catch (const std::exception& e) {
-                        Logger::error("Exception in timer callback for '{}': {}", name_, e.what());
-                    }
-                    (*schedule_func)();
+        // All of this component's timers multiplex onto the thread's
+        // wheel; the wheel already guards callback exceptions, so only
+        // the component-stopped check is added here
+        return concrete_thread->timer_wheel().schedule_recurring(
+            interval, [this, callback = std::move(callback)]() {
+                if (running_.load()) {
+                    callback();
                 }
             });
-        };
-
-        // Start the timer
-        post_task(*schedule_func);
-        return timer_id;
     }
 
     /**
@@ -991,10 +1261,9 @@ protected:
      * @param timer_id Timer ID returned by schedule_timer
      */
     void cancel_timer(std::size_t timer_id) {
-        auto it = timers_.find(timer_id);
-        if (it != timers_.end()) {
-            it->second->cancel();
-            timers_.erase(it);
+        auto concrete_thread = concrete_managed_thread();
+        if (concrete_thread) {
+            concrete_thread->timer_wheel().cancel(timer_id);
         }
     }
 
@@ -1014,10 +1283,6 @@ private:
     std::shared_ptr<ManagedThreadBase> managed_thread_;
     std::atomic<bool> running_{false};
 
-    // Timer management
-    std::unordered_map<std::size_t, std::shared_ptr<asio::steady_timer>> timers_;
-    std::atomic<std::size_t> next_timer_id_{1};
-
     // Deferred message subscription setup
     std::vector<std::function<void()>> pending_subscriptions_;
 };
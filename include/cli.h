@@ -35,6 +35,16 @@ namespace base {
 class Application;
 enum class ApplicationState;
 
+/**
+ * @brief Incremental output generator for streaming CLI results
+ *
+ * Fills the next output chunk and returns true, or returns false once
+ * all chunks have been produced. Invoked repeatedly by the CLI transport,
+ * which writes each chunk before requesting the next one, so only a
+ * single chunk is ever held in memory.
+ */
+using CLIOutputProducer = std::function<bool(std::string&)>;
+
 /**
  * @brief CLI command result
  */
@@ -42,6 +52,7 @@ struct CLIResult {
     bool success{true};
     std::string output;
     std::string error_message;
+    CLIOutputProducer output_producer;  // Set for streaming results
 
     CLIResult() = default;
     CLIResult(bool s, std::string out = "", std::string err = "")
@@ -54,6 +65,23 @@ struct CLIResult {
     static CLIResult error(std::string error_msg) {
         return CLIResult{false, "", std::move(error_msg)};
     }
+
+    /**
+     * @brief Create a streaming result whose output is produced in chunks
+     * @param producer Chunk generator, e.g. Table::create_stream_producer
+     *
+     * Use for outputs too large to materialize up front (multi-million-row
+     * table dumps): the transport drains the producer chunk by chunk with
+     * bounded memory instead of building one giant string.
+     */
+    static CLIResult stream(CLIOutputProducer producer) {
+        CLIResult result{true, "", ""};
+        result.output_producer = std::move(producer);
+        return result;
+    }
+
+    /// True when output is delivered via output_producer instead of output
+    bool is_streaming() const noexcept { return static_cast<bool>(output_producer); }
 };
 
 /**
@@ -119,6 +147,7 @@ struct CLIConfig {
  * - config: Show configuration
  * - health: Run health checks
  * - messaging: Show messaging statistics
+ * - metrics: Show metrics registry snapshot
  * - log-level: Change log level
  * - shutdown: Graceful shutdown
  * - force-shutdown: Immediate shutdown
@@ -265,6 +294,18 @@ private:
      */
     void process_commands(std::istream& input, std::ostream& output, bool prompt_enabled = true);
 
+    /**
+     * @brief Drain a streaming result into a chunk writer
+     * @param result Result whose output_producer supplies the chunks
+     * @param write_chunk Invoked once per chunk, in order
+     *
+     * Chunks are written as they are produced so peak memory stays at one
+     * chunk regardless of total output size. A producer exception aborts
+     * the stream with an error line rather than killing the connection.
+     */
+    void stream_result_output(CLIResult& result,
+                              const std::function<void(const std::string&)>& write_chunk);
+
     // Built-in command handlers
     CLIResult cmd_help(const CLIContext& context);
     CLIResult cmd_status(const CLIContext& context);
@@ -272,6 +313,7 @@ private:
     CLIResult cmd_config(const CLIContext& context);
     CLIResult cmd_health(const CLIContext& context);
     CLIResult cmd_messaging(const CLIContext& context);
+    CLIResult cmd_metrics(const CLIContext& context);
     CLIResult cmd_log_level(const CLIContext& context);
     CLIResult cmd_shutdown(const CLIContext& context);
     CLIResult cmd_force_shutdown(const CLIContext& context);
@@ -11,6 +11,10 @@
 #include "singleton.h"
 #include "logger.h"
 #include <toml++/toml.hpp>
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <filesystem>
@@ -68,6 +72,76 @@ struct NetworkConfig {
     std::string ssl_key_path;               ///< SSL private key path
 };
 
+/**
+ * @brief A single key difference produced by a configuration reload
+ *
+ * Keys are dotted paths within the app table (e.g. "tuning.batch_size").
+ * Added or removed subtrees are reported as one change per leaf key.
+ */
+struct ConfigChange {
+    enum class Type {
+        Added,    ///< Key exists in the new configuration only
+        Modified, ///< Key exists in both with a different value
+        Removed   ///< Key exists in the old configuration only
+    };
+
+    std::string app_name;         ///< Application whose table changed
+    std::string key;              ///< Dotted key path within the app table
+    Type type = Type::Modified;   ///< Kind of change
+};
+
+class ConfigManager;
+
+/**
+ * @brief Concept for structs usable with ConfigManager::bind
+ *
+ * The struct materializes itself from the manager once per (re)load:
+ * @code
+ * struct TuningSnapshot {
+ *     int batch_size;
+ *     static TuningSnapshot from_config(const ConfigManager& manager,
+ *                                       std::string_view app_name);
+ * };
+ * @endcode
+ */
+template<typename T>
+concept ConfigSnapshotType =
+    requires(const ConfigManager& manager, std::string_view app_name) {
+        { T::from_config(manager, app_name) } -> std::same_as<T>;
+    };
+
+/**
+ * @brief Handle to a typed configuration snapshot
+ *
+ * Obtained from ConfigManager::bind. snapshot() is a single atomic
+ * shared_ptr load — no locking, no TOML traversal — so it is safe to
+ * call in per-request code. The snapshot a caller holds stays
+ * immutable and valid across reloads; re-read snapshot() to observe
+ * refreshed values.
+ */
+template<ConfigSnapshotType T>
+class ConfigBinding {
+public:
+    /**
+     * @brief Current immutable snapshot of the bound struct
+     */
+    std::shared_ptr<const T> snapshot() const noexcept {
+        return state_->current.load(std::memory_order_acquire);
+    }
+
+private:
+    friend class ConfigManager;
+
+    struct State {
+        std::atomic<std::shared_ptr<const T>> current;
+    };
+
+    explicit ConfigBinding(std::shared_ptr<State> state)
+        : state_(std::move(state)) {}
+
+    std::shared_ptr<State> state_;
+};
+
 /**
  * @brief Main configuration container holding all app configurations
  */
@@ -137,6 +211,48 @@ public:
     template<typename T>
     T get_value_or(std::string_view key, const T& default_value, std::string_view app_name = "default") const;
 
+    /**
+     * @brief Bind a typed snapshot struct to this configuration
+     * @tparam T Struct satisfying ConfigSnapshotType
+     * @param app_name Application name passed to T::from_config
+     * @return Binding whose snapshot() is one atomic load per read
+     *
+     * T::from_config runs once now and again after every successful
+     * load, reload, or clear, publishing a fresh immutable snapshot
+     * behind an atomic shared_ptr. Steady-state reads therefore never
+     * take the config lock or walk the TOML tree. The binding stops
+     * refreshing when the last ConfigBinding handle is dropped.
+     */
+    template<ConfigSnapshotType T>
+    ConfigBinding<T> bind(std::string_view app_name = "default") {
+        auto state = std::make_shared<typename ConfigBinding<T>::State>();
+        state->current.store(
+            std::make_shared<const T>(T::from_config(*this, app_name)),
+            std::memory_order_release);
+
+        std::lock_guard<std::mutex> lock(bindings_mutex_);
+        binding_refreshers_.push_back(
+            [this,
+             weak_state = std::weak_ptr<typename ConfigBinding<T>::State>(state),
+             app = std::string(app_name)]() {
+                auto live_state = weak_state.lock();
+                if (!live_state) {
+                    return false;  // Binding dropped: stop refreshing
+                }
+                try {
+                    live_state->current.store(
+                        std::make_shared<const T>(T::from_config(*this, app)),
+                        std::memory_order_release);
+                } catch (const std::exception& e) {
+                    // Keep serving the previous snapshot
+                    Logger::error("Failed to refresh config snapshot for app '{}': {}",
+                                  app, e.what());
+                }
+                return true;
+            });
+        return ConfigBinding<T>(std::move(state));
+    }
+
     /**
      * @brief Check if configuration exists for an application
      * @param app_name Application name
@@ -168,6 +284,45 @@ public:
     static bool create_config_template(const std::filesystem::path& config_path,
                                      std::string_view app_name = "default");
 
+    /// Callback invoked once per changed key after a reload
+    using ConfigChangeHandler = std::function<void(const ConfigChange&)>;
+
+    /**
+     * @brief Subscribe to incremental configuration change notifications
+     * @param handler Invoked once per changed key after each successful
+     *        load or reload; unchanged keys produce no callbacks
+     * @return Subscription id for unsubscribe_changes
+     *
+     * Lets consumers react only to the keys they care about instead of
+     * re-reading everything on reload:
+     * @code
+     * ConfigManager::instance().subscribe_changes([](const ConfigChange& change) {
+     *     if (change.key.starts_with("logging.")) {
+     *         ConfigManager::instance().configure_logger(change.app_name);
+     *     }
+     * });
+     * @endcode
+     */
+    std::size_t subscribe_changes(ConfigChangeHandler handler);
+
+    /**
+     * @brief Remove a change subscription
+     * @param id Value returned by subscribe_changes
+     */
+    void unsubscribe_changes(std::size_t id);
+
+    /**
+     * @brief Reload the config file if it changed on disk
+     *
+     * Compares the file's modification time against the last load and
+     * triggers reload_config() — and therefore diff notifications —
+     * only when it moved. Intended to be polled from a recurring timer
+     * (see Application::enable_config_hot_reload).
+     *
+     * @return true if a change was detected and the reload ran
+     */
+    bool poll_file_changes();
+
     /**
      * @brief Reload configuration from the last loaded file
      * @return true if configuration was reloaded successfully
@@ -191,10 +346,39 @@ private:
     LogLevel parse_log_level(std::string_view level_str) const;
     std::string log_level_to_string(LogLevel level) const;
 
+    /**
+     * @brief Re-materialize every live snapshot binding
+     *
+     * Called after the config mutex is released so refreshers can read
+     * through the normal locked accessors.
+     */
+    void refresh_bindings();
+
+    // Change diffing helpers: walk old and new app tables and emit one
+    // ConfigChange per differing leaf key
+    static void diff_tables(std::string_view app_name, const std::string& prefix,
+                            const toml::table& old_table,
+                            const toml::table& new_table,
+                            std::vector<ConfigChange>& changes);
+    static void collect_keys(std::string_view app_name, const std::string& prefix,
+                             const toml::table& table, ConfigChange::Type type,
+                             std::vector<ConfigChange>& changes);
+
+    /// Invokes every subscribed handler once per change, outside all locks
+    void notify_changes(const std::vector<ConfigChange>& changes);
+
     // Internal storage
     std::unordered_map<std::string, toml::table> app_configs_;
     std::filesystem::path last_config_path_;
+    std::filesystem::file_time_type last_write_time_{};
     mutable std::shared_mutex config_mutex_;
+
+    std::mutex bindings_mutex_;
+    std::vector<std::function<bool()>> binding_refreshers_;
+
+    mutable std::mutex change_handlers_mutex_;
+    std::unordered_map<std::size_t, ConfigChangeHandler> change_handlers_;
+    std::size_t next_change_handler_id_{1};
 };
 
 // Template implementations
@@ -11,12 +11,46 @@
 #include <spdlog/common.h>
 #include <spdlog/spdlog.h>
 #include <fmt/format.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <string_view>
 #include <source_location>
 #include <memory>
 #include <filesystem>
 #include <vector>
 
+// ======================================
+// COMPILE-TIME LEVEL GATE
+// ======================================
+
+// Numeric values mirror the LogLevel enum below
+#define BASE_LOG_LEVEL_TRACE 0
+#define BASE_LOG_LEVEL_DEBUG 1
+#define BASE_LOG_LEVEL_INFO 2
+#define BASE_LOG_LEVEL_WARN 3
+#define BASE_LOG_LEVEL_ERROR 4
+#define BASE_LOG_LEVEL_CRITICAL 5
+#define BASE_LOG_LEVEL_OFF 6
+
+/**
+ * @brief Minimum log level compiled into the binary.
+ *
+ * Calls below this level compile to nothing: the templated wrappers
+ * discard their bodies via if constexpr, and the BASE_LOG_* / LOGGER_*
+ * statement macros expand to a no-op, so format arguments are never
+ * evaluated. Define before including logger.h (or via the build system,
+ * e.g. -DBASE_LOG_ACTIVE_LEVEL=BASE_LOG_LEVEL_INFO) to strip trace and
+ * debug logging from release builds.
+ */
+#ifndef BASE_LOG_ACTIVE_LEVEL
+#define BASE_LOG_ACTIVE_LEVEL BASE_LOG_LEVEL_TRACE
+#endif
+
+namespace spdlog::details {
+class thread_pool;
+}
+
 namespace base {
 
 // Forward declarations
@@ -35,6 +69,14 @@ enum class LogLevel : int {
     Off = 6
 };
 
+/**
+ * @brief Overflow behavior when the asynchronous logging ring buffer is full.
+ */
+enum class AsyncOverflowPolicy : int {
+    Block = 0,      ///< Producer waits for a free slot (no loss, bounded by drain rate)
+    DropOldest = 1  ///< Overwrite the oldest queued message and count the drop
+};
+
 /**
  * @brief Convenience macro for creating component loggers with cleaner syntax.
  *
@@ -134,6 +176,11 @@ struct LoggerConfig {
     std::vector<std::string> enabled_components{};                  ///< Only log these components (empty = all enabled)
     std::vector<std::string> disabled_components{};                 ///< Exclude these components from logging
     std::string component_pattern = "[%Y-%m-%d %H:%M:%S.%e] [%n] [%^%l%$] %v"; ///< Pattern for component logging
+
+    // Asynchronous logging configuration
+    bool enable_async = false;                                      ///< Drain sinks from a background thread instead of inline
+    std::size_t async_queue_size = 8192;                            ///< Preallocated ring-buffer slots for pending messages
+    AsyncOverflowPolicy async_overflow_policy = AsyncOverflowPolicy::Block; ///< Behavior when the ring buffer is full
 };
 
 class ComponentLogger; // Forward declarations
@@ -192,10 +239,112 @@ private:
     std::string component_name_;
 };
 
+// ======================================
+// PER-CALL-SITE RATE LIMITING STATE
+// ======================================
+
+/**
+ * @brief Per-call-site counter behind BASE_LOG_EVERY_N
+ *
+ * Instantiated as a function-local static by the macro, so every call
+ * site gets its own counter. All operations are relaxed atomics; the
+ * suppressed case costs one fetch_add.
+ */
+class LogEveryNState {
+public:
+    /**
+     * @brief Claim the next emission slot
+     * @param n Emit every n-th call
+     * @param suppressed Receives the number of calls suppressed since
+     *        the last emission (reported as a summary line)
+     * @return true if this call should log
+     */
+    bool acquire(std::uint64_t n, std::uint64_t& suppressed) noexcept {
+        const auto count = counter_.fetch_add(1, std::memory_order_relaxed);
+        if (n <= 1 || count % n == 0) {
+            suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+private:
+    std::atomic<std::uint64_t> counter_{0};
+    std::atomic<std::uint64_t> suppressed_{0};
+};
+
+/**
+ * @brief Per-call-site counter behind BASE_LOG_FIRST_N
+ *
+ * Once the quota is exhausted the fast path is a single relaxed load.
+ */
+class LogFirstNState {
+public:
+    /**
+     * @brief Claim one of the first n emissions
+     * @return true if fewer than n calls have logged so far
+     */
+    bool acquire(std::uint64_t n) noexcept {
+        if (counter_.load(std::memory_order_relaxed) >= n) {
+            return false;
+        }
+        return counter_.fetch_add(1, std::memory_order_relaxed) < n;
+    }
+
+private:
+    std::atomic<std::uint64_t> counter_{0};
+};
+
+/**
+ * @brief Per-call-site token bucket behind BASE_LOG_RATE_LIMITED
+ *
+ * Allows one emission per interval; calls landing inside the window
+ * are counted and reported as a summary when the next emission wins.
+ */
+class LogRateLimitState {
+public:
+    /**
+     * @brief Claim the current emission window
+     * @param interval Minimum spacing between emissions
+     * @param suppressed Receives the number of calls suppressed since
+     *        the last emission
+     * @return true if this call should log
+     */
+    bool acquire(std::chrono::milliseconds interval,
+                 std::uint64_t& suppressed) noexcept {
+        const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count();
+        auto next = next_allowed_ns_.load(std::memory_order_relaxed);
+        if (now < next) {
+            suppressed_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        const auto interval_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+        if (next_allowed_ns_.compare_exchange_strong(next, now + interval_ns,
+                                                     std::memory_order_relaxed)) {
+            suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Another thread claimed this window first
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+private:
+    std::atomic<std::int64_t> next_allowed_ns_{0};
+    std::atomic<std::uint64_t> suppressed_{0};
+};
+
 class Logger {
 private:
     // Static members must be declared first
     static std::shared_ptr<spdlog::logger> s_logger;
+    static std::shared_ptr<spdlog::details::thread_pool> s_thread_pool;
     static bool s_component_logging_enabled;
     static std::vector<std::string> s_enabled_components;
     static std::vector<std::string> s_disabled_components;
@@ -211,7 +360,7 @@ public:
      */
     struct Component {
         std::string_view name;
-        explicit Component(std::string_view n) : name(n) {}
+        constexpr explicit Component(std::string_view n) noexcept : name(n) {}
     };
 
     // ======================================
@@ -244,6 +393,27 @@ public:
      */
     static bool is_initialized() noexcept { return get_internal_logger() != nullptr; }
 
+    /**
+     * @brief Whether a level survives the BASE_LOG_ACTIVE_LEVEL compile-time gate.
+     * @param level Log level to test
+     * @return true if calls at this level are compiled into the binary
+     */
+    static constexpr bool level_compiled_in(LogLevel level) noexcept {
+        return static_cast<int>(level) >= BASE_LOG_ACTIVE_LEVEL;
+    }
+
+    /**
+     * @brief Check whether sink I/O runs on the async background thread.
+     * @return true if the logger was initialized with enable_async
+     */
+    static bool is_async() noexcept { return s_thread_pool != nullptr; }
+
+    /**
+     * @brief Messages lost to the DropOldest overflow policy.
+     * @return Drop count since async initialization (0 for synchronous loggers)
+     */
+    static std::size_t async_overrun_count() noexcept;
+
     /**
      * @brief Flush all pending log messages.
      */
@@ -347,8 +517,10 @@ public:
      */
     template <typename... Args>
     static void trace(std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::trace)) {
-            log_with_location(spdlog::level::trace, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Trace)) {
+            if (s_logger && s_logger->should_log(spdlog::level::trace)) {
+                log_with_location(spdlog::level::trace, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -360,8 +532,10 @@ public:
      */
     template <typename... Args>
     static void trace(Component comp, std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::trace) && is_component_enabled(comp.name)) {
-            log_with_location(spdlog::level::trace, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Trace)) {
+            if (s_logger && s_logger->should_log(spdlog::level::trace) && is_component_enabled(comp.name)) {
+                log_with_location(spdlog::level::trace, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -373,8 +547,10 @@ public:
      */
     template <typename... Args>
     static void debug(std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::debug)) {
-            log_with_location(spdlog::level::debug, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Debug)) {
+            if (s_logger && s_logger->should_log(spdlog::level::debug)) {
+                log_with_location(spdlog::level::debug, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -386,8 +562,10 @@ public:
      */
     template <typename... Args>
     static void debug(Component comp, std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::debug) && is_component_enabled(comp.name)) {
-            log_with_location(spdlog::level::debug, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Debug)) {
+            if (s_logger && s_logger->should_log(spdlog::level::debug) && is_component_enabled(comp.name)) {
+                log_with_location(spdlog::level::debug, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -401,8 +579,10 @@ public:
      */
     template <typename... Args>
     static void info(std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::info)) {
-            log_with_location(spdlog::level::info, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Info)) {
+            if (s_logger && s_logger->should_log(spdlog::level::info)) {
+                log_with_location(spdlog::level::info, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -414,8 +594,10 @@ public:
      */
     template <typename... Args>
     static void info(Component comp, std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::info) && is_component_enabled(comp.name)) {
-            log_with_location(spdlog::level::info, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Info)) {
+            if (s_logger && s_logger->should_log(spdlog::level::info) && is_component_enabled(comp.name)) {
+                log_with_location(spdlog::level::info, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -427,8 +609,10 @@ public:
      */
     template <typename... Args>
     static void warn(std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::warn)) {
-            log_with_location(spdlog::level::warn, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Warn)) {
+            if (s_logger && s_logger->should_log(spdlog::level::warn)) {
+                log_with_location(spdlog::level::warn, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -440,8 +624,10 @@ public:
      */
     template <typename... Args>
     static void warn(Component comp, std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::warn) && is_component_enabled(comp.name)) {
-            log_with_location(spdlog::level::warn, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Warn)) {
+            if (s_logger && s_logger->should_log(spdlog::level::warn) && is_component_enabled(comp.name)) {
+                log_with_location(spdlog::level::warn, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -453,8 +639,10 @@ public:
      */
     template <typename... Args>
     static void error(std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::err)) {
-            log_with_location(spdlog::level::err, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Error)) {
+            if (s_logger && s_logger->should_log(spdlog::level::err)) {
+                log_with_location(spdlog::level::err, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -466,8 +654,10 @@ public:
      */
     template <typename... Args>
     static void error(Component comp, std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::err) && is_component_enabled(comp.name)) {
-            log_with_location(spdlog::level::err, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Error)) {
+            if (s_logger && s_logger->should_log(spdlog::level::err) && is_component_enabled(comp.name)) {
+                log_with_location(spdlog::level::err, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -479,8 +669,10 @@ public:
      */
     template <typename... Args>
     static void critical(std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::critical)) {
-            log_with_location(spdlog::level::critical, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Critical)) {
+            if (s_logger && s_logger->should_log(spdlog::level::critical)) {
+                log_with_location(spdlog::level::critical, "", fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -492,8 +684,10 @@ public:
      */
     template <typename... Args>
     static void critical(Component comp, std::string_view fmt, Args&&... args) {
-        if (s_logger && s_logger->should_log(spdlog::level::critical) && is_component_enabled(comp.name)) {
-            log_with_location(spdlog::level::critical, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        if constexpr (level_compiled_in(LogLevel::Critical)) {
+            if (s_logger && s_logger->should_log(spdlog::level::critical) && is_component_enabled(comp.name)) {
+                log_with_location(spdlog::level::critical, comp.name, fmt, std::source_location::current(), std::forward<Args>(args)...);
+            }
         }
     }
 
@@ -511,7 +705,7 @@ public:
      * Logger::info(net, "Connected to {}", server);
      * @endcode
      */
-    static Component component(std::string_view name) { return Component(name); }
+    static constexpr Component component(std::string_view name) noexcept { return Component(name); }
 
     /**
      * @brief Check if logger is ready for use (convenience alias).
@@ -623,49 +817,61 @@ private:
 
 template <typename... Args>
 void ComponentLogger::trace(std::string_view fmt, Args&&... args) const {
-    auto logger = Logger::get_internal_logger();
-    if (logger && logger->should_log(spdlog::level::trace) && Logger::is_component_enabled(component_name_)) {
-        Logger::internal_log_with_location(spdlog::level::trace, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+    if constexpr (Logger::level_compiled_in(LogLevel::Trace)) {
+        auto logger = Logger::get_internal_logger();
+        if (logger && logger->should_log(spdlog::level::trace) && Logger::is_component_enabled(component_name_)) {
+            Logger::internal_log_with_location(spdlog::level::trace, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        }
     }
 }
 
 template <typename... Args>
 void ComponentLogger::debug(std::string_view fmt, Args&&... args) const {
-    auto logger = Logger::get_internal_logger();
-    if (logger && logger->should_log(spdlog::level::debug) && Logger::is_component_enabled(component_name_)) {
-        Logger::internal_log_with_location(spdlog::level::debug, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+    if constexpr (Logger::level_compiled_in(LogLevel::Debug)) {
+        auto logger = Logger::get_internal_logger();
+        if (logger && logger->should_log(spdlog::level::debug) && Logger::is_component_enabled(component_name_)) {
+            Logger::internal_log_with_location(spdlog::level::debug, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        }
     }
 }
 
 template <typename... Args>
 void ComponentLogger::info(std::string_view fmt, Args&&... args) const {
-    auto logger = Logger::get_internal_logger();
-    if (logger && logger->should_log(spdlog::level::info) && Logger::is_component_enabled(component_name_)) {
-        Logger::internal_log_with_location(spdlog::level::info, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+    if constexpr (Logger::level_compiled_in(LogLevel::Info)) {
+        auto logger = Logger::get_internal_logger();
+        if (logger && logger->should_log(spdlog::level::info) && Logger::is_component_enabled(component_name_)) {
+            Logger::internal_log_with_location(spdlog::level::info, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        }
     }
 }
 
 template <typename... Args>
 void ComponentLogger::warn(std::string_view fmt, Args&&... args) const {
-    auto logger = Logger::get_internal_logger();
-    if (logger && logger->should_log(spdlog::level::warn) && Logger::is_component_enabled(component_name_)) {
-        Logger::internal_log_with_location(spdlog::level::warn, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+    if constexpr (Logger::level_compiled_in(LogLevel::Warn)) {
+        auto logger = Logger::get_internal_logger();
+        if (logger && logger->should_log(spdlog::level::warn) && Logger::is_component_enabled(component_name_)) {
+            Logger::internal_log_with_location(spdlog::level::warn, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        }
     }
 }
 
 template <typename... Args>
 void ComponentLogger::error(std::string_view fmt, Args&&... args) const {
-    auto logger = Logger::get_internal_logger();
-    if (logger && logger->should_log(spdlog::level::err) && Logger::is_component_enabled(component_name_)) {
-        Logger::internal_log_with_location(spdlog::level::err, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+    if constexpr (Logger::level_compiled_in(LogLevel::Error)) {
+        auto logger = Logger::get_internal_logger();
+        if (logger && logger->should_log(spdlog::level::err) && Logger::is_component_enabled(component_name_)) {
+            Logger::internal_log_with_location(spdlog::level::err, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        }
     }
 }
 
 template <typename... Args>
 void ComponentLogger::critical(std::string_view fmt, Args&&... args) const {
-    auto logger = Logger::get_internal_logger();
-    if (logger && logger->should_log(spdlog::level::critical) && Logger::is_component_enabled(component_name_)) {
-        Logger::internal_log_with_location(spdlog::level::critical, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+    if constexpr (Logger::level_compiled_in(LogLevel::Critical)) {
+        auto logger = Logger::get_internal_logger();
+        if (logger && logger->should_log(spdlog::level::critical) && Logger::is_component_enabled(component_name_)) {
+            Logger::internal_log_with_location(spdlog::level::critical, component_name_, fmt, std::source_location::current(), std::forward<Args>(args)...);
+        }
     }
 }
 
@@ -685,17 +891,244 @@ void ComponentLogger::critical(std::string_view fmt, Args&&... args) const {
  */
 #define LOGGER_COMPONENT(name) auto name = base::Logger::component(#name)
 
+/**
+ * @brief Level-gated logging macros that never evaluate elided arguments.
+ *
+ * Unlike direct calls to Logger::trace etc. (whose arguments are
+ * evaluated before the call even when the body is discarded), these
+ * expand to a no-op below BASE_LOG_ACTIVE_LEVEL, so expensive format
+ * arguments in hot loops cost nothing when compiled out.
+ *
+ * @code
+ * BASE_LOG_DEBUG("cache state: {}", expensive_dump());  // elided entirely
+ * @endcode
+ */
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_TRACE
+#define BASE_LOG_TRACE(...) base::Logger::trace(__VA_ARGS__)
+#else
+#define BASE_LOG_TRACE(...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_DEBUG
+#define BASE_LOG_DEBUG(...) base::Logger::debug(__VA_ARGS__)
+#else
+#define BASE_LOG_DEBUG(...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_INFO
+#define BASE_LOG_INFO(...) base::Logger::info(__VA_ARGS__)
+#else
+#define BASE_LOG_INFO(...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_WARN
+#define BASE_LOG_WARN(...) base::Logger::warn(__VA_ARGS__)
+#else
+#define BASE_LOG_WARN(...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_ERROR
+#define BASE_LOG_ERROR(...) base::Logger::error(__VA_ARGS__)
+#else
+#define BASE_LOG_ERROR(...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_CRITICAL
+#define BASE_LOG_CRITICAL(...) base::Logger::critical(__VA_ARGS__)
+#else
+#define BASE_LOG_CRITICAL(...) static_cast<void>(0)
+#endif
+
 /**
  * @brief Convenience macro for logging with implicit component creation.
  *
+ * The component filter is checked before the format arguments are
+ * evaluated, so a component disabled by configuration skips argument
+ * evaluation entirely; below BASE_LOG_ACTIVE_LEVEL the whole statement
+ * compiles to nothing. The component tag itself is constexpr.
+ *
  * @code
  * LOGGER_INFO("network", "Connected to server {}", addr);
  * // Equivalent to: base::Logger::info(base::Logger::component("network"), "Connected to server {}", addr);
  * @endcode
  */
-#define LOGGER_TRACE(comp, ...) base::Logger::trace(base::Logger::component(comp), __VA_ARGS__)
-#define LOGGER_DEBUG(comp, ...) base::Logger::debug(base::Logger::component(comp), __VA_ARGS__)
-#define LOGGER_INFO(comp, ...)  base::Logger::info(base::Logger::component(comp), __VA_ARGS__)
-#define LOGGER_WARN(comp, ...)  base::Logger::warn(base::Logger::component(comp), __VA_ARGS__)
-#define LOGGER_ERROR(comp, ...) base::Logger::error(base::Logger::component(comp), __VA_ARGS__)
-#define LOGGER_CRITICAL(comp, ...) base::Logger::critical(base::Logger::component(comp), __VA_ARGS__)
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_TRACE
+#define LOGGER_TRACE(comp, ...)                                                   \
+    do {                                                                          \
+        if (base::Logger::is_component_enabled(comp)) {                           \
+            base::Logger::trace(base::Logger::component(comp), __VA_ARGS__);      \
+        }                                                                         \
+    } while (0)
+#else
+#define LOGGER_TRACE(comp, ...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_DEBUG
+#define LOGGER_DEBUG(comp, ...)                                                   \
+    do {                                                                          \
+        if (base::Logger::is_component_enabled(comp)) {                           \
+            base::Logger::debug(base::Logger::component(comp), __VA_ARGS__);      \
+        }                                                                         \
+    } while (0)
+#else
+#define LOGGER_DEBUG(comp, ...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_INFO
+#define LOGGER_INFO(comp, ...)                                                    \
+    do {                                                                          \
+        if (base::Logger::is_component_enabled(comp)) {                           \
+            base::Logger::info(base::Logger::component(comp), __VA_ARGS__);       \
+        }                                                                         \
+    } while (0)
+#else
+#define LOGGER_INFO(comp, ...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_WARN
+#define LOGGER_WARN(comp, ...)                                                    \
+    do {                                                                          \
+        if (base::Logger::is_component_enabled(comp)) {                           \
+            base::Logger::warn(base::Logger::component(comp), __VA_ARGS__);       \
+        }                                                                         \
+    } while (0)
+#else
+#define LOGGER_WARN(comp, ...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_ERROR
+#define LOGGER_ERROR(comp, ...)                                                   \
+    do {                                                                          \
+        if (base::Logger::is_component_enabled(comp)) {                           \
+            base::Logger::error(base::Logger::component(comp), __VA_ARGS__);      \
+        }                                                                         \
+    } while (0)
+#else
+#define LOGGER_ERROR(comp, ...) static_cast<void>(0)
+#endif
+
+#if BASE_LOG_ACTIVE_LEVEL <= BASE_LOG_LEVEL_CRITICAL
+#define LOGGER_CRITICAL(comp, ...)                                                \
+    do {                                                                          \
+        if (base::Logger::is_component_enabled(comp)) {                           \
+            base::Logger::critical(base::Logger::component(comp), __VA_ARGS__);   \
+        }                                                                         \
+    } while (0)
+#else
+#define LOGGER_CRITICAL(comp, ...) static_cast<void>(0)
+#endif
+
+// ======================================
+// PER-CALL-SITE RATE LIMITING MACROS
+// ======================================
+
+/**
+ * @brief Rate-limited logging: emit every n-th call at this call site.
+ *
+ * The level is the lowercase Logger method name, so the component
+ * overloads work too. Suppressed calls cost one relaxed atomic
+ * operation and never evaluate the format arguments; each emission is
+ * followed by a "suppressed N duplicates" summary when calls were
+ * skipped since the last one.
+ *
+ * @code
+ * BASE_LOG_EVERY_N(error, 1000, "backend {} unreachable: {}", host, err);
+ * @endcode
+ */
+#define BASE_LOG_EVERY_N(level, n, ...)                                           \
+    do {                                                                          \
+        static base::LogEveryNState base_log_site_state;                          \
+        std::uint64_t base_log_suppressed = 0;                                    \
+        if (base_log_site_state.acquire((n), base_log_suppressed)) {              \
+            base::Logger::level(__VA_ARGS__);                                     \
+            if (base_log_suppressed > 0) {                                        \
+                base::Logger::level("(suppressed {} duplicates of the previous "  \
+                                    "message)",                                   \
+                                    base_log_suppressed);                         \
+            }                                                                     \
+        }                                                                         \
+    } while (0)
+
+/**
+ * @brief Rate-limited logging: emit only the first n calls at this call site.
+ *
+ * Once the quota is spent, the call is a single relaxed load.
+ */
+#define BASE_LOG_FIRST_N(level, n, ...)                                           \
+    do {                                                                          \
+        static base::LogFirstNState base_log_site_state;                          \
+        if (base_log_site_state.acquire((n))) {                                   \
+            base::Logger::level(__VA_ARGS__);                                     \
+        }                                                                         \
+    } while (0)
+
+/**
+ * @brief Rate-limited logging: emit at most once per interval at this call site.
+ *
+ * Token-bucket variant for error paths that fire millions of times
+ * during an outage; the interval is in milliseconds. Suppressed
+ * duplicates are counted and reported alongside the next emission.
+ *
+ * @code
+ * BASE_LOG_RATE_LIMITED(error, 5000, "dependency down: {}", reason);
+ * @endcode
+ */
+#define BASE_LOG_RATE_LIMITED(level, interval_ms, ...)                            \
+    do {                                                                          \
+        static base::LogRateLimitState base_log_site_state;                       \
+        std::uint64_t base_log_suppressed = 0;                                    \
+        if (base_log_site_state.acquire(std::chrono::milliseconds(interval_ms),   \
+                                        base_log_suppressed)) {                   \
+            base::Logger::level(__VA_ARGS__);                                     \
+            if (base_log_suppressed > 0) {                                        \
+                base::Logger::level("(suppressed {} duplicates of the previous "  \
+                                    "message)",                                   \
+                                    base_log_suppressed);                         \
+            }                                                                     \
+        }                                                                         \
+    } while (0)
+
+/**
+ * @brief ComponentLogger counterparts of the rate-limiting macros.
+ *
+ * @code
+ * COMPONENT_LOGGER(network);
+ * COMPONENT_LOG_EVERY_N(network, warn, 100, "retry {} failed", attempt);
+ * @endcode
+ */
+#define COMPONENT_LOG_EVERY_N(logger, level, n, ...)                              \
+    do {                                                                          \
+        static base::LogEveryNState base_log_site_state;                          \
+        std::uint64_t base_log_suppressed = 0;                                    \
+        if (base_log_site_state.acquire((n), base_log_suppressed)) {              \
+            (logger).level(__VA_ARGS__);                                          \
+            if (base_log_suppressed > 0) {                                        \
+                (logger).level("(suppressed {} duplicates of the previous "       \
+                               "message)",                                        \
+                               base_log_suppressed);                              \
+            }                                                                     \
+        }                                                                         \
+    } while (0)
+
+#define COMPONENT_LOG_FIRST_N(logger, level, n, ...)                              \
+    do {                                                                          \
+        static base::LogFirstNState base_log_site_state;                          \
+        if (base_log_site_state.acquire((n))) {                                   \
+            (logger).level(__VA_ARGS__);                                          \
+        }                                                                         \
+    } while (0)
+
+#define COMPONENT_LOG_RATE_LIMITED(logger, level, interval_ms, ...)               \
+    do {                                                                          \
+        static base::LogRateLimitState base_log_site_state;                       \
+        std::uint64_t base_log_suppressed = 0;                                    \
+        if (base_log_site_state.acquire(std::chrono::milliseconds(interval_ms),   \
+                                        base_log_suppressed)) {                   \
+            (logger).level(__VA_ARGS__);                                          \
+            if (base_log_suppressed > 0) {                                        \
+                (logger).level("(suppressed {} duplicates of the previous "       \
+                               "message)",                                        \
+                               base_log_suppressed);                              \
+            }                                                                     \
+        }                                                                         \
+    } while (0)
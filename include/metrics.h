@@ -0,0 +1,220 @@
+/*
+ * @file metrics.h
+ * @brief Process-wide low-overhead metrics registry
+ *
+ * Counters, gauges and histograms registered by name and updated with
+ * relaxed atomics, so framework hot paths (task posting, message
+ * delivery, table mutation) can export rates at near-zero cost. The
+ * registry is a process-wide singleton; snapshots are taken on demand
+ * (e.g. by the CLI "metrics" command) without pausing writers.
+ *
+ * Metric objects are never destroyed once created, so the reference
+ * returned by counter()/gauge()/histogram() is stable for the process
+ * lifetime. Hot paths should cache it in a function-local static to pay
+ * the name lookup only once:
+ * @code
+ * static auto& posted = MetricsRegistry::instance().counter("application.tasks_posted");
+ * posted.increment();
+ * @endcode
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "singleton.h"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace base {
+
+/**
+ * @brief Monotonically increasing event counter
+ */
+class Counter {
+public:
+    void increment(std::uint64_t amount = 1) noexcept {
+        value_.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    std::uint64_t value() const noexcept {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+    void reset() noexcept { value_.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::uint64_t> value_{0};
+};
+
+/**
+ * @brief Point-in-time value that can move in both directions
+ */
+class Gauge {
+public:
+    void set(std::int64_t value) noexcept {
+        value_.store(value, std::memory_order_relaxed);
+    }
+
+    void add(std::int64_t delta) noexcept {
+        value_.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    std::int64_t value() const noexcept {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+    void reset() noexcept { value_.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::int64_t> value_{0};
+};
+
+/**
+ * @brief Fixed-bucket histogram with power-of-two bucket boundaries
+ *
+ * Bucket i counts values in [2^(i-1), 2^i); bucket 0 counts zero.
+ * record() is three relaxed atomic adds with no allocation or locking,
+ * so it is safe on hot paths. Percentiles are approximated by the upper
+ * bound of the bucket containing the requested rank, which is accurate
+ * to within a factor of two — enough to tell a 10µs path from a 10ms
+ * one without per-sample storage.
+ */
+class Histogram {
+public:
+    static constexpr std::size_t BUCKET_COUNT = 64;
+
+    void record(std::uint64_t value) noexcept {
+        buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    std::uint64_t count() const noexcept {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t sum() const noexcept {
+        return sum_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t bucket_count(std::size_t index) const noexcept {
+        return buckets_[index].load(std::memory_order_relaxed);
+    }
+
+    /// Inclusive upper bound of bucket `index` (0 for the zero bucket)
+    static constexpr std::uint64_t bucket_upper_bound(std::size_t index) noexcept {
+        if (index == 0) {
+            return 0;
+        }
+        if (index >= BUCKET_COUNT - 1) {
+            return UINT64_MAX;
+        }
+        return (std::uint64_t{1} << index) - 1;
+    }
+
+    /**
+     * @brief Approximate percentile from bucket boundaries
+     * @param fraction Rank in [0.0, 1.0], e.g. 0.99 for p99
+     */
+    std::uint64_t percentile(double fraction) const noexcept;
+
+    void reset() noexcept;
+
+private:
+    static constexpr std::size_t bucket_index(std::uint64_t value) noexcept {
+        if (value == 0) {
+            return 0;
+        }
+        std::size_t index = std::bit_width(value);
+        return index < BUCKET_COUNT ? index : BUCKET_COUNT - 1;
+    }
+
+    std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> sum_{0};
+};
+
+/**
+ * @brief One metric's value at snapshot time
+ */
+struct MetricSample {
+    enum class Kind { Counter, Gauge, Histogram };
+
+    std::string name;
+    Kind kind = Kind::Counter;
+    std::int64_t value = 0;    ///< Counter/gauge value (providers report as gauges)
+    std::uint64_t count = 0;   ///< Histogram sample count
+    std::uint64_t sum = 0;     ///< Histogram sample sum
+    std::uint64_t p50 = 0;     ///< Approximate histogram percentiles
+    std::uint64_t p90 = 0;
+    std::uint64_t p99 = 0;
+};
+
+/**
+ * @brief Process-wide registry of named metrics
+ *
+ * Lookup takes a mutex; updates through the returned references do not.
+ * Providers are callbacks evaluated at snapshot time for values owned
+ * elsewhere (e.g. the async logger's overrun counter) and are reported
+ * as gauges.
+ */
+class MetricsRegistry : public SingletonBase<MetricsRegistry> {
+    friend class SingletonBase<MetricsRegistry>;
+
+public:
+    /// Get or create the counter with the given name
+    Counter& counter(const std::string& name);
+
+    /// Get or create the gauge with the given name
+    Gauge& gauge(const std::string& name);
+
+    /// Get or create the histogram with the given name
+    Histogram& histogram(const std::string& name);
+
+    /**
+     * @brief Register a snapshot-time value provider
+     * @param name Metric name the provider reports under
+     * @param provider Invoked on each snapshot; exceptions skip the sample
+     * @return Registration id for unregister_provider
+     */
+    std::size_t register_provider(std::string name,
+                                  std::function<std::int64_t()> provider);
+
+    /// Remove a provider; safe to call with an already-removed id
+    void unregister_provider(std::size_t id);
+
+    /// Collect all metrics, sorted by name
+    std::vector<MetricSample> snapshot() const;
+
+    /// Zero every counter, gauge and histogram (providers are untouched)
+    void reset();
+
+private:
+    MetricsRegistry() = default;
+
+    struct Provider {
+        std::size_t id;
+        std::string name;
+        std::function<std::int64_t()> fn;
+    };
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::unique_ptr<Counter>> counters_;
+    std::unordered_map<std::string, std::unique_ptr<Gauge>> gauges_;
+    std::unordered_map<std::string, std::unique_ptr<Histogram>> histograms_;
+    std::vector<Provider> providers_;
+    std::size_t next_provider_id_{1};
+};
+
+} // namespace base
@@ -0,0 +1,303 @@
+/*
+ * @file shm_messaging.h
+ * @brief Shared-memory cross-process transport for the messaging bus
+ *
+ * Extends the in-process messaging system with a same-host IPC path:
+ * a shared-memory ring segment per process pair carrying trivially
+ * copyable message types with the familiar subscribe<T>/send_message
+ * API, replacing localhost socket round-trips with plain ring writes.
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include "logger.h"
+#include "thread_messaging.h"
+
+namespace base {
+
+/**
+ * @brief Concept for messages that can cross a process boundary
+ *
+ * Shared-memory delivery copies raw object bytes, so only trivially
+ * copyable types without pointers into the sending process are safe.
+ * The byte-layout contract (and the typeid-based routing below) assumes
+ * both processes run binaries built from the same library version with
+ * the same compiler.
+ */
+template<typename T>
+concept ShmMessageType = std::is_trivially_copyable_v<T>;
+
+/**
+ * @brief Single-consumer byte ring living in a POSIX shared-memory segment
+ *
+ * Low-level building block of SharedMemoryTransport. The segment holds a
+ * small header with atomic head/tail cursors followed by a power-of-two
+ * data area; records are a fixed header (type hash + payload size) plus
+ * the payload bytes. Whichever process maps the segment first initializes
+ * it, guarded by an atomic state word, so creation order between the two
+ * endpoints does not matter.
+ *
+ * Writes never block: a full ring returns false, which is the producer's
+ * backpressure signal (mirroring BatchedChannel::try_send). Producers
+ * within one process are serialized by a local mutex; across processes
+ * each direction has exactly one producing process and one consuming
+ * process, so the cross-process protocol stays single-producer/
+ * single-consumer on the shared cursors.
+ */
+class ShmRing {
+public:
+    /// Default data-area size per direction
+    static constexpr std::size_t DEFAULT_CAPACITY = 1 << 20;
+
+    /// Callback receiving one decoded record during drain
+    using RecordSink =
+        std::function<void(std::uint64_t type_hash, const unsigned char* payload,
+                           std::size_t size)>;
+
+    ShmRing() = default;
+    ~ShmRing();
+
+    // Non-copyable, non-movable: the mapping address is referenced internally
+    ShmRing(const ShmRing&) = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+
+    /**
+     * @brief Create or attach to a named shared-memory segment
+     * @param name Segment name (leading '/' added by the caller)
+     * @param capacity Requested data-area size, rounded up to a power of two
+     * @return true if the segment is mapped and initialized
+     */
+    bool open(const std::string& name, std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Unmap the segment; the segment itself persists for the peer
+     */
+    void close();
+
+    /**
+     * @brief Remove a named segment from the system
+     */
+    static void unlink(const std::string& name);
+
+    /**
+     * @brief Append one record without blocking
+     * @return false if the ring is not open or full (backpressure)
+     */
+    bool write(std::uint64_t type_hash, const void* payload, std::size_t size);
+
+    /**
+     * @brief Consume pending records in arrival order
+     * @param sink Invoked once per record with payload bytes valid for the call
+     * @param max_records Upper bound on records consumed in this call
+     * @return Number of records consumed
+     */
+    std::size_t drain(const RecordSink& sink, std::size_t max_records);
+
+    bool is_open() const noexcept { return header_ != nullptr; }
+
+    std::size_t capacity() const noexcept { return capacity_; }
+
+private:
+    struct Header;
+
+    void copy_in(std::uint64_t pos, const void* src, std::size_t size);
+    void copy_out(std::uint64_t pos, void* dst, std::size_t size) const;
+
+    std::string name_;
+    int fd_{-1};
+    void* mapping_{nullptr};
+    std::size_t mapping_size_{0};
+    Header* header_{nullptr};
+    unsigned char* data_{nullptr};
+    std::size_t capacity_{0};
+    std::size_t mask_{0};
+
+    std::mutex write_mutex_;
+    std::vector<unsigned char> scratch_;  // Reused for records that wrap
+};
+
+/**
+ * @brief Cross-process message transport over shared-memory rings
+ *
+ * One transport per local endpoint/peer pair. Each direction uses its own
+ * ShmRing segment named from the endpoint pair, so two processes that
+ * construct mirrored transports ("a"->"b" and "b"->"a") connect without
+ * any rendezvous step. The API mirrors ThreadMessagingContext:
+ * subscribe<T> registers a typed handler and send_message<T> enqueues a
+ * message, but payloads must satisfy ShmMessageType because delivery is
+ * a raw byte copy through the segment.
+ *
+ * A send is a single ring write in the caller's thread — no syscall, no
+ * serialization. The receive side polls its inbound ring from the owning
+ * io_context at poll_interval (default 100us), so end-to-end latency is
+ * bounded by the poll interval while the write itself stays sub-
+ * microsecond. send_message returns false when the outbound ring is
+ * full; the producer applies backpressure, as with BatchedChannel.
+ *
+ * Segments persist after stop() so a restarting peer picks up where it
+ * left off; remove_segments() deletes them when a pair is retired.
+ */
+class SharedMemoryTransport {
+public:
+    /// Inbound ring poll period on the owning io_context
+    static constexpr std::chrono::microseconds DEFAULT_POLL_INTERVAL{100};
+
+    /// Records consumed per poll before yielding the event loop
+    static constexpr std::size_t MAX_POLL_BATCH = 256;
+
+    /**
+     * @brief Create a transport endpoint
+     * @param local_name Name of this process's endpoint
+     * @param peer_name Name of the peer process's endpoint
+     * @param io_context Event loop that runs handlers and the inbound poll
+     * @param ring_capacity Per-direction ring size in bytes
+     * @param poll_interval Inbound poll period
+     */
+    SharedMemoryTransport(
+        std::string local_name, std::string peer_name, asio::io_context& io_context,
+        std::size_t ring_capacity = ShmRing::DEFAULT_CAPACITY,
+        std::chrono::microseconds poll_interval = DEFAULT_POLL_INTERVAL);
+
+    ~SharedMemoryTransport();
+
+    // Non-copyable, non-movable: the poll timer captures this
+    SharedMemoryTransport(const SharedMemoryTransport&) = delete;
+    SharedMemoryTransport& operator=(const SharedMemoryTransport&) = delete;
+
+    /**
+     * @brief Map both ring segments and start polling the inbound ring
+     * @return true if both segments are mapped
+     */
+    bool start();
+
+    /**
+     * @brief Stop polling and unmap the segments (segments persist)
+     */
+    void stop();
+
+    /**
+     * @brief Remove the segment pair for two endpoints from the system
+     *
+     * Call from either side once the pairing is permanently retired.
+     */
+    static void remove_segments(const std::string& name_a, const std::string& name_b);
+
+    /**
+     * @brief Send a message to the peer process
+     *
+     * Copies the message bytes into the outbound ring. Never blocks.
+     *
+     * @param data Message data
+     * @param priority Message priority (currently informational; the
+     *        shared ring preserves arrival order)
+     * @return false if the transport is stopped or the ring is full
+     */
+    template<ShmMessageType T>
+    bool send_message(T data, MessagePriority priority = MessagePriority::Normal) {
+        (void)priority;
+        if (!running_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        return send_ring_.write(message_type_hash<T>(), &data, sizeof(T));
+    }
+
+    /**
+     * @brief Subscribe to messages of a specific type from the peer
+     *
+     * Handlers run on the owning io_context. Incoming records with no
+     * subscribed handler are consumed and dropped.
+     */
+    template<ShmMessageType T>
+    void subscribe(MessageHandler<T> handler) {
+        std::lock_guard<std::mutex> lock(handlers_mutex_);
+        handlers_[message_type_hash<T>()] =
+            [handler = std::move(handler)](const unsigned char* payload,
+                                           std::size_t size) {
+                if (size != sizeof(T)) {
+                    Logger::warn(
+                        "Shared-memory message size mismatch: expected {}, got {}",
+                        sizeof(T), size);
+                    return;
+                }
+                T data;
+                std::memcpy(&data, payload, sizeof(T));
+                handler(data);
+            };
+    }
+
+    /**
+     * @brief Unsubscribe from a message type
+     */
+    template<ShmMessageType T>
+    void unsubscribe() {
+        std::lock_guard<std::mutex> lock(handlers_mutex_);
+        handlers_.erase(message_type_hash<T>());
+    }
+
+    const std::string& local_name() const noexcept { return local_name_; }
+    const std::string& peer_name() const noexcept { return peer_name_; }
+
+    bool is_running() const noexcept {
+        return running_.load(std::memory_order_acquire);
+    }
+
+private:
+    static std::string segment_name(const std::string& from, const std::string& to);
+
+    /**
+     * @brief Route one record type across processes
+     *
+     * FNV-1a over typeid(T).name(), computed once per type. Stable as
+     * long as both processes are built with the same compiler, which the
+     * byte-copy payload contract already requires.
+     */
+    template<ShmMessageType T>
+    static std::uint64_t message_type_hash() {
+        static const std::uint64_t hash = [] {
+            std::uint64_t value = 14695981039346656037ULL;
+            for (const char* c = typeid(T).name(); *c != '\0'; ++c) {
+                value ^= static_cast<unsigned char>(*c);
+                value *= 1099511628211ULL;
+            }
+            return value;
+        }();
+        return hash;
+    }
+
+    void poll();
+    void arm_poll_timer();
+
+    std::string local_name_;
+    std::string peer_name_;
+    asio::io_context& io_context_;
+    std::size_t ring_capacity_;
+    std::chrono::microseconds poll_interval_;
+
+    ShmRing send_ring_;
+    ShmRing receive_ring_;
+    asio::steady_timer poll_timer_{io_context_};
+    std::atomic<bool> running_{false};
+
+    mutable std::mutex handlers_mutex_;
+    std::unordered_map<std::uint64_t,
+                       std::function<void(const unsigned char*, std::size_t)>>
+        handlers_;
+};
+
+} // namespace base
@@ -32,7 +32,10 @@
 #include <functional>
 #include <memory>
 #include <shared_mutex>
+#include <mutex>
 #include <atomic>
+#include <array>
+#include <deque>
 #include <chrono>
 #include <typeinfo>
 #include <typeindex>
@@ -137,6 +140,37 @@ inline std::ostream& operator<<(std::ostream& os, const CellValue& value) {
     return os;
 }
 
+/**
+ * @brief Stable integer identifier for an interned column name
+ */
+using ColumnId = std::uint32_t;
+
+/// Sentinel for "no column ID assigned"
+inline constexpr ColumnId INVALID_COLUMN_ID = std::numeric_limits<ColumnId>::max();
+
+/**
+ * @brief Process-wide interner mapping column names to stable integer IDs
+ *
+ * IDs are assigned on first intern of a name and are never reused, so row
+ * cells can be keyed by cheap integer hashes instead of hashing the column
+ * name string on every access. Schemas intern their columns at add_column
+ * time; the string-based row accessors resolve through this registry and
+ * remain available as a thin compatibility layer.
+ */
+class ColumnRegistry {
+public:
+    /**
+     * @brief Return the ID for a column name, assigning one on first use
+     */
+    static ColumnId intern(const std::string& name);
+
+    /**
+     * @brief Return the name a column ID was assigned for
+     * @throws std::invalid_argument if the ID was never assigned
+     */
+    static const std::string& name_of(ColumnId id);
+};
+
 /**
  * @brief Constraint types for column validation
  */
@@ -171,6 +205,7 @@ struct ColumnConstraint {
  */
 struct ColumnDefinition {
     std::string name;
+    ColumnId id = INVALID_COLUMN_ID;  // Assigned by TableSchema::add_column
     ColumnType type;
     bool nullable = true;
     std::vector<ColumnConstraint> constraints;
@@ -188,6 +223,8 @@ enum class ChangeType {
     RowInserted,
     RowUpdated,
     RowDeleted,
+    RowsBulkInserted,  // One event per insert_rows batch; row_id is the first
+                       // row of the batch, new_values carries "row_count"
     SchemaChanged,
     IndexCreated,
     IndexDropped
@@ -215,6 +252,31 @@ struct ChangeEvent {
  */
 using ChangeCallback = std::function<void(const ChangeEvent&)>;
 
+/**
+ * @brief Compact change notification: row ID and changed columns, no payload
+ *
+ * For subscribers that only need to know what changed, not the values;
+ * avoids copying both row value maps into every queued event.
+ */
+struct ChangeSummary {
+    ChangeType type;
+    std::size_t row_id = 0;
+    std::vector<ColumnId> changed_columns;
+    std::chrono::system_clock::time_point timestamp;
+};
+
+/// Batch delivery callback types (see Table::drain_change_events)
+using BatchChangeCallback = std::function<void(const std::vector<ChangeEvent>&)>;
+using ChangeSummaryCallback = std::function<void(const std::vector<ChangeSummary>&)>;
+
+/**
+ * @brief What the change-event queue stores per mutation
+ */
+enum class ChangeQueueMode {
+    FullEvents,     // Queue full ChangeEvents; summaries derived on drain
+    SummariesOnly   // Queue only ChangeSummary records; cheapest enqueue
+};
+
 /**
  * @brief Query operator types
  */
@@ -237,15 +299,26 @@ enum class QueryOperator {
  */
 struct QueryCondition {
     std::string column;
+    ColumnId column_id = INVALID_COLUMN_ID;  // Resolved at construction
     QueryOperator op;
     CellValue value;
     std::optional<CellValue> value2;  // For BETWEEN operator
 
     QueryCondition(std::string col, QueryOperator o, CellValue val)
-        : column(std::move(col)), op(o), value(std::move(val)) {}
+        : column(std::move(col)), column_id(ColumnRegistry::intern(column))
+        , op(o), value(std::move(val)) {}
 
     QueryCondition(std::string col, QueryOperator o, CellValue val1, CellValue val2)
-        : column(std::move(col)), op(o), value(std::move(val1)), value2(std::move(val2)) {}
+        : column(std::move(col)), column_id(ColumnRegistry::intern(column))
+        , op(o), value(std::move(val1)), value2(std::move(val2)) {}
+
+    QueryCondition(ColumnId col, QueryOperator o, CellValue val)
+        : column(ColumnRegistry::name_of(col)), column_id(col)
+        , op(o), value(std::move(val)) {}
+
+    QueryCondition(ColumnId col, QueryOperator o, CellValue val1, CellValue val2)
+        : column(ColumnRegistry::name_of(col)), column_id(col)
+        , op(o), value(std::move(val1)), value2(std::move(val2)) {}
 };
 
 /**
@@ -256,6 +329,7 @@ public:
     TableQuery& select(const std::vector<std::string>& columns);
     TableQuery& where(const QueryCondition& condition);
     TableQuery& where(const std::string& column, QueryOperator op, const CellValue& value);
+    TableQuery& where(ColumnId column, QueryOperator op, const CellValue& value);
     TableQuery& order_by(const std::string& column, bool ascending = true);
     TableQuery& limit(std::size_t count);
     TableQuery& offset(std::size_t count);
@@ -281,11 +355,19 @@ class TableRow {
 public:
     TableRow(std::size_t id) : id_(id), version_(1), created_at_(std::chrono::system_clock::now()) {}
 
-    // Cell value access
+    // Cell value access by interned column ID (no string hashing)
+    void set_value(ColumnId column, const CellValue& value);
+    CellValue get_value(ColumnId column) const;
+    bool has_column(ColumnId column) const;
+
+    // String-keyed access; resolves through the ColumnRegistry
     void set_value(const std::string& column, const CellValue& value);
     CellValue get_value(const std::string& column) const;
     bool has_column(const std::string& column) const;
 
+    // Zero-copy peek at a cell; returns nullptr when the column is absent
+    const CellValue* find_cell(ColumnId column) const;
+
     // Metadata
     std::size_t get_id() const { return id_; }
     void set_id(std::size_t id) { id_ = id; }  // Allow ID modification for merge operations
@@ -296,8 +378,11 @@ public:
     // Internal version management
     void increment_version();
 
-    // Get all values
-    const std::unordered_map<std::string, CellValue>& get_all_values() const { return values_; }
+    // Get all values keyed by name (materialized through the ColumnRegistry)
+    std::unordered_map<std::string, CellValue> get_all_values() const;
+
+    // Get all cells in their native ID-keyed representation
+    const std::unordered_map<ColumnId, CellValue>& get_all_cells() const { return values_; }
 
     // Serialization
     std::string to_json() const;
@@ -308,11 +393,102 @@ private:
     std::uint32_t version_;
     std::chrono::system_clock::time_point created_at_;
     std::chrono::system_clock::time_point updated_at_;
-    std::unordered_map<std::string, CellValue> values_;
+    std::unordered_map<ColumnId, CellValue> values_;
 
     friend class Table;
+    friend class ColumnStore;
 };
 
+/**
+ * @brief Slab-based pool allocator for TableRow objects
+ *
+ * Allocates TableRow storage from large slabs instead of one heap
+ * allocation per row, and recycles freed slots through a free list so
+ * sustained insert/delete cycles stop round-tripping through the global
+ * allocator. reclaim() releases all but the first slab in one step after
+ * the owning table has been cleared.
+ *
+ * Not thread-safe on its own; the owning Table serializes access through
+ * its table mutex.
+ */
+class RowPool {
+public:
+    static constexpr std::size_t DEFAULT_SLAB_CAPACITY = 1024;  // Rows per slab
+
+    explicit RowPool(std::size_t slab_capacity = DEFAULT_SLAB_CAPACITY);
+
+    RowPool(const RowPool&) = delete;
+    RowPool& operator=(const RowPool&) = delete;
+    RowPool(RowPool&&) noexcept = default;
+    RowPool& operator=(RowPool&&) noexcept = default;
+
+    /**
+     * @brief Construct a TableRow in pool storage
+     */
+    TableRow* construct(std::size_t row_id);
+    TableRow* construct(const TableRow& other);
+
+    /**
+     * @brief Destroy a pooled row and return its slot to the free list
+     */
+    void destroy(TableRow* row) noexcept;
+
+    /**
+     * @brief Release all but the first slab (bulk reclamation after clear)
+     */
+    void reclaim();
+
+    std::size_t slab_count() const noexcept { return slabs_.size(); }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    void* allocate_slot();
+
+    std::vector<std::unique_ptr<std::byte[]>> slabs_;
+    std::size_t slab_capacity_;
+    std::size_t next_slot_ = 0;       // Next unused slot in the newest slab
+    FreeNode* free_list_ = nullptr;   // Recycled slots, LIFO
+};
+
+/**
+ * @brief Deleter that returns a pooled row to its owning RowPool
+ */
+struct RowDeleter {
+    RowPool* pool = nullptr;
+
+    void operator()(TableRow* row) const noexcept {
+        if (row && pool) {
+            pool->destroy(row);
+        }
+    }
+};
+
+using PooledRow = std::unique_ptr<TableRow, RowDeleter>;
+using RowMap = std::unordered_map<std::size_t, PooledRow>;
+
+/// Number of row shards; a power of two so shard selection is a mask
+inline constexpr std::size_t ROW_SHARD_COUNT = 16;
+
+/**
+ * @brief One partition of a table's row storage
+ *
+ * Rows are distributed across shards by row ID, each shard with its own
+ * lock and row pool, so independent row operations on different shards can
+ * proceed in parallel (see the locking notes on Table::shards_).
+ */
+struct RowShard {
+    mutable std::shared_mutex mutex;
+    // Heap-owned so RowDeleter pointers stay valid across Table moves/swaps;
+    // declared before rows so pooled rows are destroyed while the pool lives
+    std::unique_ptr<RowPool> pool = std::make_unique<RowPool>();
+    RowMap rows;
+};
+
+using RowShardArray = std::array<RowShard, ROW_SHARD_COUNT>;
+
 /**
  * @brief Table schema with versioning support
  */
@@ -330,6 +506,7 @@ public:
     std::uint32_t get_version() const { return version_; }
     const std::vector<ColumnDefinition>& get_columns() const { return columns_; }
     std::optional<ColumnDefinition> get_column(const std::string& name) const;
+    std::optional<ColumnId> get_column_id(const std::string& name) const;
 
     // Validation
     bool validate_row(const TableRow& row) const;
@@ -356,12 +533,28 @@ private:
     friend class Table;
 };
 
+/**
+ * @brief Index implementation kind
+ */
+enum class IndexKind {
+    Ordered,  ///< std::map-based composite index; supports exact and range lookups
+    Hash      ///< Hash-based composite index; equality lookups only, single probe
+};
+
+/**
+ * @brief Hash functor for composite CellValue index keys
+ */
+struct CellKeyHash {
+    std::size_t operator()(const std::vector<CellValue>& key) const;
+};
+
 /**
  * @brief Table index for fast lookups
  */
 class TableIndex {
 public:
-    TableIndex(std::string name, std::vector<std::string> columns, bool unique = false);
+    TableIndex(std::string name, std::vector<std::string> columns, bool unique = false,
+               IndexKind kind = IndexKind::Ordered);
 
     // Copy constructor and assignment operator
     TableIndex(const TableIndex& other);
@@ -374,6 +567,11 @@ public:
 
     // Lookup operations
     std::vector<std::size_t> find_exact(const std::vector<CellValue>& key) const;
+
+    /**
+     * @brief Range lookup over the ordered representation
+     * @throws std::runtime_error for hash indexes, which are equality-only
+     */
     std::vector<std::size_t> find_range(const std::vector<CellValue>& start_key,
                                        const std::vector<CellValue>& end_key) const;
 
@@ -381,6 +579,7 @@ public:
     std::string get_name() const { return name_; }
     const std::vector<std::string>& get_columns() const { return columns_; }
     bool is_unique() const { return unique_; }
+    IndexKind get_kind() const { return kind_; }
 
     // Statistics
     std::size_t size() const;
@@ -389,15 +588,73 @@ public:
 private:
     std::string name_;
     std::vector<std::string> columns_;
+    std::vector<ColumnId> column_ids_;  // Interned once; extract_key avoids string hashing
     bool unique_;
+    IndexKind kind_;
 
-    // Multi-column index using composite keys
+    // Multi-column index using composite keys; only the container matching
+    // kind_ is populated
     std::map<std::vector<CellValue>, std::set<std::size_t>> index_;
+    std::unordered_map<std::vector<CellValue>, std::set<std::size_t>, CellKeyHash> hash_index_;
     mutable std::shared_mutex mutex_;
 
     std::vector<CellValue> extract_key(const TableRow& row) const;
 };
 
+/**
+ * @brief Immutable backing data shared by snapshot handles
+ */
+struct TableSnapshotData {
+    std::uint64_t version = 0;  // Table data version at capture time
+    std::vector<TableRow> rows;
+    std::unordered_map<std::size_t, std::size_t> row_index;  // row ID -> rows slot
+};
+
+/**
+ * @brief Point-in-time, lock-free view of a table's rows
+ *
+ * Returned by Table::snapshot(). The handle shares immutable backing data,
+ * so copying it is O(1) and readers iterate without holding any table lock
+ * — long-running reports see a consistent state while ingest continues.
+ * Repeated snapshot() calls return the same backing data until the table
+ * changes, so a quiescent table pays the row copy only once.
+ */
+class TableSnapshot {
+public:
+    using const_iterator = std::vector<TableRow>::const_iterator;
+
+    TableSnapshot() = default;
+
+    /// Table data version this snapshot was captured at
+    std::uint64_t version() const { return data_ ? data_->version : 0; }
+
+    std::size_t size() const { return data_ ? data_->rows.size() : 0; }
+    bool empty() const { return size() == 0; }
+
+    const_iterator begin() const { return data_ ? data_->rows.begin() : const_iterator{}; }
+    const_iterator end() const { return data_ ? data_->rows.end() : const_iterator{}; }
+    const std::vector<TableRow>& rows() const {
+        static const std::vector<TableRow> empty_rows;
+        return data_ ? data_->rows : empty_rows;
+    }
+
+    /// Row as of capture time, or nullptr if it did not exist then
+    const TableRow* get_row(std::size_t row_id) const {
+        if (!data_) {
+            return nullptr;
+        }
+        auto it = data_->row_index.find(row_id);
+        return it != data_->row_index.end() ? &data_->rows[it->second] : nullptr;
+    }
+
+private:
+    friend class Table;
+    explicit TableSnapshot(std::shared_ptr<const TableSnapshotData> data)
+        : data_(std::move(data)) {}
+
+    std::shared_ptr<const TableSnapshotData> data_;
+};
+
 /**
  * @brief Transaction context for atomic operations
  */
@@ -406,11 +663,24 @@ public:
     TableTransaction(Table* table, std::string id);
     ~TableTransaction();
 
-    // Transaction operations
+    // Transaction operations. begin() captures a snapshot of the table;
+    // staged writes are buffered and only touch the table at commit().
     void begin();
     void commit();
     void rollback();
 
+    // Staged row operations (require an active transaction).
+    // update_row/delete_row return false if the row was not visible in the
+    // snapshot. Conflicting concurrent commits are detected via the row
+    // version field: commit() throws if any touched row has moved past the
+    // version the snapshot saw (first committer wins).
+    void insert_row(const std::unordered_map<std::string, CellValue>& values);
+    bool update_row(std::size_t row_id, const std::unordered_map<std::string, CellValue>& values);
+    bool delete_row(std::size_t row_id);
+
+    /// Consistent view of the table as of begin()
+    const TableSnapshot& get_snapshot() const { return snapshot_; }
+
     // State management
     bool is_active() const { return active_; }
     bool is_committed() const { return committed_; }
@@ -425,9 +695,16 @@ private:
     bool committed_ = false;
     bool rolled_back_ = false;
 
-    // Transaction log for rollback
+    // Snapshot captured at begin(); reads and conflict checks resolve
+    // against it
+    TableSnapshot snapshot_;
+
+    // Staged operations, applied in order at commit()
     std::vector<ChangeEvent> change_log_;
 
+    // Row versions the snapshot saw for rows this transaction touches
+    std::unordered_map<std::size_t, std::uint32_t> expected_versions_;
+
     friend class Table;
 };
 
@@ -443,8 +720,7 @@ public:
     using reference = const TableRow&;
 
     TableIterator() = default;
-    TableIterator(const std::unordered_map<std::size_t, std::unique_ptr<TableRow>>& rows,
-                  std::unordered_map<std::size_t, std::unique_ptr<TableRow>>::const_iterator it);
+    TableIterator(const RowShardArray& shards, std::size_t shard_index);
 
     reference operator*() const;
     pointer operator->() const;
@@ -454,8 +730,11 @@ public:
     bool operator!=(const TableIterator& other) const;
 
 private:
-    std::unordered_map<std::size_t, std::unique_ptr<TableRow>>::const_iterator current_;
-    std::unordered_map<std::size_t, std::unique_ptr<TableRow>>::const_iterator end_;
+    void advance_to_populated_shard();
+
+    const RowShardArray* shards_ = nullptr;
+    std::size_t shard_index_ = ROW_SHARD_COUNT;
+    RowMap::const_iterator current_{};
 };
 
 /**
@@ -470,8 +749,7 @@ public:
     using reference = const TableRow&;
 
     TableConstIterator() = default;
-    TableConstIterator(const std::unordered_map<std::size_t, std::unique_ptr<TableRow>>& rows,
-                       std::unordered_map<std::size_t, std::unique_ptr<TableRow>>::const_iterator it);
+    TableConstIterator(const RowShardArray& shards, std::size_t shard_index);
 
     reference operator*() const;
     pointer operator->() const;
@@ -481,8 +759,78 @@ public:
     bool operator!=(const TableConstIterator& other) const;
 
 private:
-    std::unordered_map<std::size_t, std::unique_ptr<TableRow>>::const_iterator current_;
-    std::unordered_map<std::size_t, std::unique_ptr<TableRow>>::const_iterator end_;
+    void advance_to_populated_shard();
+
+    const RowShardArray* shards_ = nullptr;
+    std::size_t shard_index_ = ROW_SHARD_COUNT;
+    RowMap::const_iterator current_{};
+};
+
+/**
+ * @brief Pinned, read-only view over table rows without deep copies
+ *
+ * Returned by Table::get_all_rows_view() and Table::query_view(). For
+ * RowStore tables the view holds the table's read locks for its lifetime
+ * and exposes const references straight into table storage, so a result
+ * of any size costs only a pointer per row. Keep views short-lived and
+ * drop them before mutating the table from the same thread — a writer
+ * would block on the locks the view is holding. Use materialize() when
+ * owned rows that outlive the view are needed.
+ *
+ * Views are movable but not copyable.
+ */
+class TableResultSet {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TableRow;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const TableRow*;
+        using reference = const TableRow&;
+
+        iterator() = default;
+        explicit iterator(const TableRow* const* pos) : pos_(pos) {}
+
+        reference operator*() const { return **pos_; }
+        pointer operator->() const { return *pos_; }
+        iterator& operator++() { ++pos_; return *this; }
+        iterator operator++(int) { auto temp = *this; ++pos_; return temp; }
+        bool operator==(const iterator& other) const { return pos_ == other.pos_; }
+        bool operator!=(const iterator& other) const { return pos_ != other.pos_; }
+
+    private:
+        const TableRow* const* pos_ = nullptr;
+    };
+    using const_iterator = iterator;
+
+    TableResultSet() = default;
+    TableResultSet(TableResultSet&&) = default;
+    TableResultSet& operator=(TableResultSet&&) = default;
+    TableResultSet(const TableResultSet&) = delete;
+    TableResultSet& operator=(const TableResultSet&) = delete;
+
+    std::size_t size() const { return rows_.size(); }
+    bool empty() const { return rows_.empty(); }
+    const TableRow& operator[](std::size_t index) const { return *rows_[index]; }
+    const TableRow& at(std::size_t index) const;
+
+    iterator begin() const { return iterator(rows_.data()); }
+    iterator end() const { return iterator(rows_.data() + rows_.size()); }
+
+    /// Deep-copies the viewed rows for callers that outlive the view
+    std::vector<TableRow> materialize() const;
+
+private:
+    friend class Table;
+
+    // Lock order matches the table's convention: table lock, then shards
+    std::shared_lock<std::shared_mutex> table_lock_;
+    std::vector<std::shared_lock<std::shared_mutex>> shard_locks_;
+    // Backing storage when rows must be materialized anyway (ColumnStore
+    // tables have no per-row objects to point into)
+    std::vector<TableRow> owned_rows_;
+    std::vector<const TableRow*> rows_;
 };
 
 /**
@@ -557,6 +905,93 @@ private:
     std::string truncate_value(const std::string& value, std::size_t max_width) const;
 };
 
+/**
+ * @brief Row storage engine used by a Table
+ */
+enum class StorageEngine {
+    RowStore,    ///< Row-oriented storage (default): one TableRow object per row
+    ColumnStore  ///< Column-oriented storage: contiguous typed vector per column
+};
+
+/**
+ * @brief Column-oriented row storage for scan-heavy workloads
+ *
+ * Stores each schema column in a contiguous typed vector selected by
+ * ColumnType, so full-table scans and aggregations touch dense arrays
+ * instead of chasing one heap-allocated hash map per row. Rows are
+ * materialized into TableRow objects on demand for the row-based APIs.
+ *
+ * Not internally synchronized: the owning Table guards access with its
+ * table mutex, exactly as it does for row-oriented storage.
+ */
+class ColumnStore {
+public:
+    explicit ColumnStore(const TableSchema& schema);
+
+    // Row operations
+    void insert(const TableRow& row);
+    bool update(const TableRow& row);
+    bool erase(std::size_t row_id);
+    bool contains(std::size_t row_id) const;
+
+    // Materialization into row-based form
+    std::optional<TableRow> materialize(std::size_t row_id) const;
+    std::vector<TableRow> materialize(const std::vector<std::size_t>& row_ids) const;
+    std::vector<TableRow> materialize_all() const;
+
+    /**
+     * @brief Evaluate query conditions with one typed loop per condition
+     * @return IDs of rows matching all conditions
+     */
+    std::vector<std::size_t> scan(const std::vector<QueryCondition>& conditions) const;
+
+    // Statistics and maintenance
+    std::size_t size() const noexcept;
+    void clear();
+    void rebind_schema(const TableSchema& schema);  // Add/drop column vectors after schema evolution
+
+private:
+    // One contiguous typed vector per column; only the vector matching
+    // `type` is populated, `nulls` marks empty/null slots.
+    struct TypedColumn {
+        std::string name;
+        ColumnId id = INVALID_COLUMN_ID;
+        ColumnType type;
+        std::vector<std::int64_t> integers;                             // Integer
+        std::vector<double> doubles;                                    // Double
+        std::vector<std::string> strings;                               // String, Json
+        std::vector<std::uint8_t> booleans;                             // Boolean
+        std::vector<std::chrono::system_clock::time_point> timestamps;  // DateTime
+        std::vector<std::vector<std::uint8_t>> blobs;                   // Binary
+        std::vector<std::uint8_t> nulls;
+
+        void resize(std::size_t slots);
+        void set(std::size_t slot, const CellValue& value);
+        CellValue get(std::size_t slot) const;
+    };
+
+    // Per-slot row metadata (what TableRow keeps next to its values)
+    struct RowMeta {
+        std::size_t row_id = 0;
+        std::uint32_t version = 1;
+        std::chrono::system_clock::time_point created_at;
+        std::chrono::system_clock::time_point updated_at;
+        bool in_use = false;
+    };
+
+    std::size_t allocate_slot(std::size_t row_id);
+    void write_row(std::size_t slot, const TableRow& row);
+    TableRow materialize_slot(std::size_t slot) const;
+    void match_condition(const TypedColumn& column, const QueryCondition& condition,
+                         std::vector<std::uint8_t>& selection) const;
+
+    std::vector<TypedColumn> columns_;
+    std::unordered_map<std::string, std::size_t> column_positions_;
+    std::vector<RowMeta> slots_;
+    std::vector<std::size_t> free_slots_;
+    std::unordered_map<std::size_t, std::size_t> row_slots_;  // row id -> slot
+};
+
 /**
  * @brief High-performance table with comprehensive features
  */
@@ -566,7 +1001,8 @@ public:
     using iterator = TableIterator;
     using const_iterator = TableConstIterator;
 
-    explicit Table(std::unique_ptr<TableSchema> schema);
+    explicit Table(std::unique_ptr<TableSchema> schema,
+                   StorageEngine engine = StorageEngine::RowStore);
     ~Table() = default;
 
     // Copy operations
@@ -579,15 +1015,25 @@ public:
 
     // Row operations
     std::size_t insert_row(const std::unordered_map<std::string, CellValue>& values);
+    // Inserts a batch under one lock acquisition with deferred index
+    // maintenance; the whole batch is validated up front and either all
+    // rows land or none do. Fires a single RowsBulkInserted event.
+    std::vector<std::size_t> insert_rows(
+        const std::vector<std::unordered_map<std::string, CellValue>>& rows);
     bool update_row(std::size_t row_id, const std::unordered_map<std::string, CellValue>& values);
     bool delete_row(std::size_t row_id);
 
     // Row access
     std::optional<TableRow> get_row(std::size_t row_id) const;
     std::vector<TableRow> get_all_rows() const;
+    // Zero-copy variant: const references pinned under the table's read
+    // locks instead of deep-copied rows (see TableResultSet)
+    TableResultSet get_all_rows_view() const;
     std::size_t get_row_count() const;
 
     // Iterator support
+    // Note: iterators walk row-oriented storage; for ColumnStore tables
+    // (which have no per-row objects) use get_all_rows() or query() instead.
     iterator begin();
     iterator end();
     const_iterator begin() const;
@@ -610,30 +1056,99 @@ public:
 
     // Query operations
     std::vector<TableRow> query(const TableQuery& query) const;
+    TableResultSet query_view(const TableQuery& query) const;
     std::vector<TableRow> find_by_index(const std::string& index_name,
                                        const std::vector<CellValue>& key) const;
 
+    // Storage engine
+    StorageEngine storage_engine() const noexcept { return storage_engine_; }
+
     // Schema management
     const TableSchema& get_schema() const { return *schema_; }
     void evolve_schema(std::unique_ptr<TableSchema> new_schema);
 
     // Index management
     void create_index(const std::string& name, const std::vector<std::string>& columns,
-                     bool unique = false);
+                     bool unique = false, IndexKind kind = IndexKind::Ordered);
     void drop_index(const std::string& name);
     std::vector<std::string> get_index_names() const;
 
-    // Change callbacks
+    // Change callbacks (synchronous, invoked inside the mutation path)
     void add_change_callback(const std::string& name, ChangeCallback callback);
     void remove_change_callback(const std::string& name);
 
+    // Batched asynchronous change delivery. With the queue enabled, every
+    // mutation appends to a bounded in-memory queue instead of (or in
+    // addition to) running subscribers inline; a consumer drains the queue
+    // in batches from an executor of its choosing (e.g. an
+    // Application::ManagedThread loop). When the queue is full new events
+    // are dropped and counted rather than stalling writers.
+    static constexpr std::size_t DEFAULT_CHANGE_QUEUE_CAPACITY = 4096;
+    void enable_change_event_queue(std::size_t capacity = DEFAULT_CHANGE_QUEUE_CAPACITY,
+                                   ChangeQueueMode mode = ChangeQueueMode::FullEvents);
+    void disable_change_event_queue();
+    bool is_change_event_queue_enabled() const;
+    std::size_t dropped_change_events() const { return dropped_change_events_.load(); }
+
+    void add_batch_change_callback(const std::string& name, BatchChangeCallback callback);
+    void remove_batch_change_callback(const std::string& name);
+    void add_change_summary_callback(const std::string& name, ChangeSummaryCallback callback);
+    void remove_change_summary_callback(const std::string& name);
+
+    /**
+     * @brief Deliver queued change events to batch and summary subscribers
+     *
+     * Call from the consumer's thread. Delivers at most max_events entries
+     * (0 = everything queued) in one callback invocation per subscriber.
+     * In FullEvents mode summary subscribers receive summaries derived
+     * from the drained events.
+     * @return Number of queue entries delivered
+     */
+    std::size_t drain_change_events(std::size_t max_events = 0);
+
     // Transaction support
     std::unique_ptr<TableTransaction> begin_transaction();
 
+    /**
+     * @brief Capture a point-in-time snapshot readers iterate without locks
+     *
+     * Amortized O(1): the backing data is cached and reused until the next
+     * mutation; only the first snapshot after a change copies rows.
+     */
+    TableSnapshot snapshot() const;
+
     // Persistence
     bool save_to_file(const std::string& filename) const;
     bool load_from_file(const std::string& filename);
 
+    /**
+     * @brief Binary persistence: schema header plus fixed-layout row records
+     *
+     * save_to_binary_file streams the table sequentially with no
+     * intermediate JSON string; load_from_binary_file memory-maps the file
+     * and constructs rows directly from the mapping. TableFactory::load_table
+     * detects the format from the file magic.
+     */
+    bool save_to_binary_file(const std::string& filename) const;
+    bool load_from_binary_file(const std::string& filename);
+
+    /**
+     * @brief Append-only write-ahead logging
+     *
+     * While enabled, every committed insert/update/delete appends one
+     * binary change record to the log, so durability costs a sequential
+     * append instead of a full-table rewrite. compact_wal() folds the
+     * current state into a binary snapshot and truncates the log;
+     * recover_from_wal() loads a snapshot (if present), replays the log,
+     * and re-enables logging on the same file. WAL attachment stays with
+     * this instance and is not transferred by copy, move, or swap.
+     */
+    bool enable_wal(const std::string& wal_path);
+    void disable_wal();
+    bool is_wal_enabled() const;
+    bool compact_wal(const std::string& snapshot_path);
+    bool recover_from_wal(const std::string& snapshot_path, const std::string& wal_path);
+
     // Serialization
     std::string to_json() const;
     bool from_json(const std::string& json);
@@ -662,6 +1177,21 @@ public:
     std::string dump_to_string(const TableDumpOptions& options = {}) const;
     std::unique_ptr<TablePager> create_pager(const TableDumpOptions& options = {}) const;
 
+    /**
+     * @brief Create a chunk producer that streams the table one page at a time
+     * @param options Dump options; page_size bounds the chunk size (0 falls
+     *        back to the default page size rather than a single huge chunk)
+     * @return Callable that fills the next formatted page and returns true,
+     *         or returns false when all pages have been produced
+     *
+     * Wraps a TablePager so large dumps can be written incrementally (e.g.
+     * by the CLI TCP server via CLIResult::stream) instead of materializing
+     * the whole formatted table in one string. Only one formatted page is
+     * held in memory at a time. The producer references this table and must
+     * not outlive it.
+     */
+    std::function<bool(std::string&)> create_stream_producer(const TableDumpOptions& options = {}) const;
+
     // CLI-friendly methods
     void print_summary() const;                                    // Print table info summary
     void print_schema() const;                                     // Print schema information
@@ -669,7 +1199,16 @@ public:
 
 private:
     std::unique_ptr<TableSchema> schema_;
-    std::unordered_map<std::size_t, std::unique_ptr<TableRow>> rows_;
+    StorageEngine storage_engine_ = StorageEngine::RowStore;
+    // Row storage is sharded by row ID with a lock and row pool per shard.
+    // Locking is two-level: structural operations (schema/index changes,
+    // clear, bulk load, persistence, copy/move) hold table_mutex_
+    // exclusively and may then touch any shard without its lock; row-level
+    // operations hold table_mutex_ shared plus the row's shard lock, so
+    // independent rows on different shards proceed in parallel. Lock order
+    // is always table_mutex_ before a shard mutex, one shard at a time.
+    RowShardArray shards_;
+    std::unique_ptr<ColumnStore> column_store_;  // Only set for StorageEngine::ColumnStore
     std::unordered_map<std::string, std::unique_ptr<TableIndex>> indexes_;
     std::unordered_map<std::string, ChangeCallback> change_callbacks_;
 
@@ -677,6 +1216,24 @@ private:
     mutable std::shared_mutex table_mutex_;
     bool concurrent_access_enabled_ = true;
 
+    // Batched change delivery state; guarded by change_queue_mutex_ except
+    // the dropped counter, which is read without it
+    mutable std::mutex change_queue_mutex_;
+    bool change_queue_enabled_ = false;
+    ChangeQueueMode change_queue_mode_ = ChangeQueueMode::FullEvents;
+    std::size_t change_queue_capacity_ = 0;
+    std::deque<ChangeEvent> queued_events_;
+    std::deque<ChangeSummary> queued_summaries_;
+    std::atomic<std::size_t> dropped_change_events_{0};
+    std::unordered_map<std::string, BatchChangeCallback> batch_change_callbacks_;
+    std::unordered_map<std::string, ChangeSummaryCallback> summary_change_callbacks_;
+
+    // Snapshot support: bumped on every data mutation so cached snapshot
+    // backing data can be reused while the table is unchanged
+    std::atomic<std::uint64_t> data_version_{0};
+    mutable std::mutex snapshot_cache_mutex_;
+    mutable std::shared_ptr<const TableSnapshotData> snapshot_cache_;
+
     // Statistics
     std::atomic<std::size_t> next_row_id_{1};
     std::atomic<std::size_t> total_inserts_{0};
@@ -685,6 +1242,35 @@ private:
     std::chrono::system_clock::time_point created_at_;
     mutable std::atomic<std::chrono::system_clock::time_point> last_modified_;
 
+    // WAL state; row-level appends hold table_mutex_ shared, so the stream
+    // itself is serialized by wal_mutex_
+    mutable std::mutex wal_mutex_;
+    std::ofstream wal_stream_;
+    std::string wal_path_;
+    bool wal_enabled_ = false;
+
+    void append_wal_record(const ChangeEvent& event);
+    void apply_wal_event_unlocked(const ChangeEvent& event);
+    bool save_to_binary_file_unlocked(const std::string& filename) const;
+
+    // Storage helpers (callers hold table_mutex_ at least shared; helpers
+    // that walk shards take the per-shard locks themselves)
+    RowShard& shard_for(std::size_t row_id) {
+        return shards_[row_id & (ROW_SHARD_COUNT - 1)];
+    }
+    const RowShard& shard_for(std::size_t row_id) const {
+        return shards_[row_id & (ROW_SHARD_COUNT - 1)];
+    }
+    std::optional<std::vector<std::size_t>> plan_index_lookup_unlocked(const TableQuery& query) const;
+    std::vector<TableRow> materialize_rows_unlocked(const std::vector<std::size_t>& row_ids) const;
+    PooledRow make_pooled_row(std::size_t row_id);
+    PooledRow make_pooled_row(const TableRow& row);
+    void store_row_unlocked(const TableRow& row);
+    std::vector<TableRow> snapshot_rows_unlocked() const;
+    std::vector<TableRow> query_rows_unlocked(const TableQuery& query) const;
+    std::optional<TableRow> get_row_unlocked(std::size_t row_id) const;
+    std::size_t row_count_unlocked() const;
+
     // Helper methods
     void fire_change_event(const ChangeEvent& event);
     bool validate_row_constraints(const TableRow& row) const;
@@ -694,6 +1280,9 @@ private:
 
     // Query evaluation
     bool evaluate_condition(const TableRow& row, const QueryCondition& condition) const;
+    void evaluate_condition_batch(const std::vector<TableRow>& rows,
+                                  const QueryCondition& condition,
+                                  std::vector<std::uint8_t>& selection) const;
     std::vector<TableRow> apply_query_filters(const std::vector<TableRow>& rows,
                                              const TableQuery& query) const;
 
@@ -710,9 +1299,10 @@ public:
     static std::unique_ptr<Table> create_table(const std::string& name,
                                              const std::vector<std::string>& column_names);
 
-    // Create table with runtime schema
+    // Create table with runtime schema and selectable storage engine
     static std::unique_ptr<Table> create_table(const std::string& name,
-                                             const std::vector<ColumnDefinition>& columns);
+                                             const std::vector<ColumnDefinition>& columns,
+                                             StorageEngine engine = StorageEngine::RowStore);
 
     // Load table from file
     static std::unique_ptr<Table> load_table(const std::string& filename);
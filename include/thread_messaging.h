@@ -11,8 +11,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <any>
+#include <array>
 #include <atomic>
+#include <vector>
+#include <bit>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <new>
 #include <functional>
 #include <unordered_map>
 #include <string>
@@ -22,6 +30,7 @@
 #include <mutex>
 #include <asio.hpp>
 #include "logger.h"
+#include "metrics.h"
 
 namespace base {
 
@@ -51,6 +60,249 @@ enum class MessagePriority : std::uint8_t {
 template<MessageType T>
 using MessageHandler = std::function<void(const T&)>;
 
+/**
+ * @brief Statically-typed message channel bound to one thread and handler
+ *
+ * Obtained once from ThreadMessagingContext::open_channel. The handler
+ * is bound at compile time, so the send hot path is a single asio::post
+ * delivering T by move into the handler invocation — no mutex, no
+ * std::type_index lookup, and no std::any type erasure per message,
+ * unlike the dynamic subscribe/send_message path.
+ *
+ * Thread-safe: any thread may send; the handler always runs on the
+ * owning thread's event loop. close() stops delivery; messages already
+ * posted but not yet processed are dropped at the handler boundary.
+ */
+template<MessageType T>
+class TypedChannel : public std::enable_shared_from_this<TypedChannel<T>> {
+public:
+    /**
+     * @brief Send a message through the channel
+     * @param data Message data (moved)
+     * @param priority Message priority (currently informational)
+     * @return true if the message was posted to the owning thread
+     */
+    bool send(T data, MessagePriority priority = MessagePriority::Normal) {
+        (void)priority;
+        if (!active_.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        try {
+            asio::post(io_context_,
+                       [self = this->shared_from_this(), data = std::move(data)]() mutable {
+                           if (self->active_.load(std::memory_order_acquire)) {
+                               self->handler_(data);
+                           }
+                       });
+            return true;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Close the channel; subsequent sends return false
+     */
+    void close() noexcept { active_.store(false, std::memory_order_release); }
+
+    /**
+     * @brief Whether the channel still delivers messages
+     */
+    bool is_open() const noexcept { return active_.load(std::memory_order_acquire); }
+
+private:
+    friend class ThreadMessagingContext;
+
+    TypedChannel(asio::io_context& io_context, MessageHandler<T> handler)
+        : io_context_(io_context), handler_(std::move(handler)) {}
+
+    asio::io_context& io_context_;
+    const MessageHandler<T> handler_;
+    std::atomic<bool> active_{true};
+};
+
+/**
+ * @brief Bounded lock-free MPSC channel with batched delivery
+ *
+ * Obtained from ThreadMessagingContext::open_batched_channel. Producers
+ * enqueue into a fixed-capacity ring (bounded MPMC algorithm with
+ * per-cell sequence counters, used here as multi-producer single-
+ * consumer) without locks, syscalls, or allocation. The first message
+ * after an empty-to-non-empty transition posts one drain task to the
+ * consumer's io_context; the drain then processes messages in batches,
+ * so a fan-in of N messages costs one post per burst instead of one per
+ * message. try_send returns false when the ring is full — the producer's
+ * backpressure signal — and never blocks.
+ *
+ * Queue depth is reported through the owning context's
+ * pending_message_count().
+ */
+template<MessageType T>
+class BatchedChannel : public std::enable_shared_from_this<BatchedChannel<T>> {
+public:
+    /// Messages processed per drain invocation before yielding the loop
+    static constexpr std::size_t MAX_DRAIN_BATCH = 128;
+
+    ~BatchedChannel() {
+        close();
+        // Destroy any messages still sitting in the ring
+        auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = cells_[pos & mask_];
+            if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            std::launder(reinterpret_cast<T*>(cell.storage))->~T();
+            ++pos;
+        }
+    }
+
+    /**
+     * @brief Try to enqueue a message without blocking
+     * @param data Message data (moved on success)
+     * @return false if the channel is closed or the ring is full
+     */
+    bool try_send(T data) {
+        if (!active_.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            auto sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                       std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Ring full: caller applies backpressure
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        ::new (static_cast<void*>(cell->storage)) T(std::move(data));
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        pending_counter_.fetch_add(1, std::memory_order_relaxed);
+
+        schedule_drain();
+        return true;
+    }
+
+    /**
+     * @brief Ring capacity (rounded up to a power of two at creation)
+     */
+    std::size_t capacity() const noexcept { return mask_ + 1; }
+
+    /**
+     * @brief Close the channel; subsequent sends return false
+     */
+    void close() noexcept { active_.store(false, std::memory_order_release); }
+
+    /**
+     * @brief Whether the channel still accepts messages
+     */
+    bool is_open() const noexcept { return active_.load(std::memory_order_acquire); }
+
+private:
+    friend class ThreadMessagingContext;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    BatchedChannel(std::shared_ptr<ThreadMessagingContext> context,
+                   std::atomic<std::size_t>& pending_counter,
+                   asio::io_context& io_context,
+                   MessageHandler<T> handler,
+                   std::size_t capacity)
+        : context_(std::move(context))
+        , pending_counter_(pending_counter)
+        , io_context_(io_context)
+        , handler_(std::move(handler))
+        , mask_(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity) - 1)
+        , cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void schedule_drain() {
+        if (drain_scheduled_.exchange(true, std::memory_order_acq_rel)) {
+            return;  // A drain is already pending; it will see this message
+        }
+        asio::post(io_context_, [self = this->shared_from_this()]() {
+            self->drain();
+        });
+    }
+
+    void drain() {
+        // Cleared before consuming so producers enqueueing mid-drain can
+        // schedule the next one; a spurious extra drain is harmless
+        drain_scheduled_.store(false, std::memory_order_release);
+
+        std::size_t processed = 0;
+        while (processed < MAX_DRAIN_BATCH) {
+            auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+            auto& cell = cells_[pos & mask_];
+            if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+                record_drain_batch(processed);
+                return;  // Ring empty
+            }
+
+            // Single consumer: plain store is sufficient
+            dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+            T* slot = std::launder(reinterpret_cast<T*>(cell.storage));
+            T data = std::move(*slot);
+            slot->~T();
+            cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+            pending_counter_.fetch_sub(1, std::memory_order_relaxed);
+            ++processed;
+
+            if (active_.load(std::memory_order_acquire)) {
+                try {
+                    handler_(data);
+                } catch (const std::exception& e) {
+                    Logger::error("Exception in batched channel handler: {}", e.what());
+                }
+            }
+        }
+
+        // Batch limit reached with messages remaining: yield the event
+        // loop and continue in a fresh drain task
+        record_drain_batch(processed);
+        schedule_drain();
+    }
+
+    static void record_drain_batch(std::size_t processed) {
+        if (processed == 0) {
+            return;  // Spurious drain; nothing to sample
+        }
+        static auto& batch_size =
+            MetricsRegistry::instance().histogram("messaging.drain_batch_size");
+        batch_size.record(processed);
+    }
+
+    // Keeps the owning context (and thus the counter) alive
+    std::shared_ptr<ThreadMessagingContext> context_;
+    std::atomic<std::size_t>& pending_counter_;
+    asio::io_context& io_context_;
+    const MessageHandler<T> handler_;
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    std::atomic<std::size_t> enqueue_pos_{0};
+    std::atomic<std::size_t> dequeue_pos_{0};
+    std::atomic<bool> drain_scheduled_{false};
+    std::atomic<bool> active_{true};
+};
+
 /**
  * @brief Event-driven thread context for high-performance messaging
  *
@@ -68,13 +320,17 @@ public:
     }
 
     /**
-     * @brief Send typed message with immediate ASIO notification
+     * @brief Send typed message with priority-lane scheduling
      *
-     * Posts message directly to target thread's ASIO event loop for
-     * immediate processing. Zero-copy semantics via move construction.
+     * Messages are staged in per-priority lanes on the target thread and
+     * each delivery pump processes the most urgent pending message, so a
+     * Critical message overtakes queued Normal traffic even when the
+     * consumer is behind. The Low lane is protected from starvation
+     * after a bounded number of consecutive higher-priority deliveries.
+     * Zero-copy semantics via move construction.
      *
      * @param data Message data (moved)
-     * @param priority Message priority (currently informational)
+     * @param priority Message priority selecting the delivery lane
      * @return true if message was posted successfully
      */
     template<MessageType T>
@@ -83,14 +339,32 @@ public:
             return false;
         }
 
+        auto lane = static_cast<std::size_t>(priority);
+        if (lane >= MESSAGE_LANE_COUNT) {
+            lane = static_cast<std::size_t>(MessagePriority::Normal);
+        }
+
         try {
-            asio::post(io_context_, [this, data = std::move(data)]() mutable {
-                if (started_.load(std::memory_order_acquire)) {
-                    process_message(std::move(data));
-                }
-            });
+            pending_messages_.fetch_add(1, std::memory_order_relaxed);
+            {
+                // shared_ptr keeps move-only payloads storable in the
+                // std::function lane entries
+                auto shared_data = std::make_shared<T>(std::move(data));
+                std::lock_guard<std::mutex> lock(lanes_mutex_);
+                message_lanes_[lane].push_back([this, shared_data]() {
+                    if (started_.load(std::memory_order_acquire)) {
+                        process_message(std::move(*shared_data));
+                    }
+                });
+            }
+            asio::post(io_context_, [this]() { run_next_prioritized_message(); });
+
+            static auto& messages_sent =
+                MetricsRegistry::instance().counter("messaging.messages_sent");
+            messages_sent.increment();
             return true;
         } catch (const std::exception&) {
+            pending_messages_.fetch_sub(1, std::memory_order_relaxed);
             return false;
         }
     }
@@ -126,6 +400,77 @@ public:
         handlers_.erase(std::type_index(typeid(T)));
     }
 
+    /**
+     * @brief Open a statically-typed channel to this thread
+     *
+     * Binds the handler once; senders keep the returned channel and pay
+     * only an asio::post per message, bypassing the mutex, typeid
+     * lookup, and std::any erasure of the dynamic send_message path.
+     * Channel delivery is independent of subscribe(): messages sent on
+     * the channel do not reach dynamic subscribers and vice versa.
+     *
+     * @code
+     * auto channel = context->open_channel<StatusUpdate>(
+     *     [](const StatusUpdate& update) { apply(update); });
+     * channel->send(StatusUpdate{...});
+     * @endcode
+     */
+    template<MessageType T>
+    std::shared_ptr<TypedChannel<T>> open_channel(MessageHandler<T> handler) {
+        return std::shared_ptr<TypedChannel<T>>(
+            new TypedChannel<T>(io_context_, std::move(handler)));
+    }
+
+    /**
+     * @brief Open a bounded lock-free MPSC channel with batched delivery
+     * @param handler Function invoked on the owning thread per message
+     * @param capacity Ring capacity, rounded up to a power of two
+     *
+     * For high-rate fan-in: producers enqueue without locks or
+     * allocation and a single drain task per burst delivers messages in
+     * batches of BatchedChannel::MAX_DRAIN_BATCH. try_send returning
+     * false (ring full) is the backpressure signal; queue depth is
+     * visible through pending_message_count().
+     */
+    template<MessageType T>
+    std::shared_ptr<BatchedChannel<T>> open_batched_channel(
+        MessageHandler<T> handler,
+        std::size_t capacity = DEFAULT_BATCHED_CHANNEL_CAPACITY) {
+        return std::shared_ptr<BatchedChannel<T>>(new BatchedChannel<T>(
+            shared_from_this(), pending_messages_, io_context_,
+            std::move(handler), capacity));
+    }
+
+    /**
+     * @brief Await the next message of type T
+     *
+     * Coroutine alternative to subscribe(): suspends the awaiting
+     * coroutine until a message of type T arrives and resumes it with
+     * the message moved into the co_await result. A pending receiver
+     * consumes the message ahead of any subscribed handler; multiple
+     * pending receivers are resumed in FIFO order, one message each.
+     *
+     * @code
+     * auto msg = co_await context->async_receive<StatusUpdate>();
+     * @endcode
+     */
+    template<MessageType T>
+    asio::awaitable<T> async_receive() {
+        return asio::async_initiate<const asio::use_awaitable_t<>&, void(T)>(
+            [self = shared_from_this()](auto handler) mutable {
+                std::lock_guard<std::mutex> lock(self->handlers_mutex_);
+                // The completion handler is move-only; shared_ptr makes the
+                // closure copyable enough for std::function storage
+                auto shared_handler =
+                    std::make_shared<std::decay_t<decltype(handler)>>(std::move(handler));
+                self->pending_receivers_[std::type_index(typeid(T))].push_back(
+                    [shared_handler](std::any data) {
+                        std::move(*shared_handler)(std::any_cast<T&&>(std::move(data)));
+                    });
+            },
+            asio::use_awaitable);
+    }
+
     /**
      * @brief Start the messaging context (register with global bus)
      */
@@ -142,16 +487,94 @@ public:
     const std::string& thread_name() const noexcept { return thread_name_; }
 
     /**
-     * @brief Get approximate message queue size (always 0 for immediate processing)
+     * @brief Approximate number of messages posted to this thread but
+     *        not yet processed
+     *
+     * Counts both the dynamic send_message path and all batched
+     * channels opened on this context; producers can poll it for
+     * backpressure decisions.
      */
-    std::size_t pending_message_count() const noexcept { return 0; }
+    std::size_t pending_message_count() const noexcept {
+        return pending_messages_.load(std::memory_order_acquire);
+    }
+
+    /// Default ring capacity for open_batched_channel
+    static constexpr std::size_t DEFAULT_BATCHED_CHANNEL_CAPACITY = 4096;
 
 private:
+    template<MessageType>
+    friend class BatchedChannel;
+
+    /// One delivery lane per MessagePriority value
+    static constexpr std::size_t MESSAGE_LANE_COUNT = 4;
+
+    /// Consecutive higher-priority deliveries before the Low lane is served
+    static constexpr std::size_t LOW_LANE_STARVATION_LIMIT = 16;
+
+    // Each send posts one pump; every pump delivers the most urgent
+    // pending message, mirroring the Application task-lane scheduler
+    void run_next_prioritized_message() {
+        std::function<void()> delivery;
+        {
+            std::lock_guard<std::mutex> lock(lanes_mutex_);
+
+            constexpr auto low_lane = static_cast<std::size_t>(MessagePriority::Low);
+            std::size_t lane = MESSAGE_LANE_COUNT;
+
+            if (low_lane_passes_ >= LOW_LANE_STARVATION_LIMIT &&
+                !message_lanes_[low_lane].empty()) {
+                lane = low_lane;
+            } else {
+                for (std::size_t l = MESSAGE_LANE_COUNT; l-- > 0;) {
+                    if (!message_lanes_[l].empty()) {
+                        lane = l;
+                        break;
+                    }
+                }
+            }
+
+            if (lane >= MESSAGE_LANE_COUNT) {
+                return;  // Drained by a concurrent pump
+            }
+
+            delivery = std::move(message_lanes_[lane].front());
+            message_lanes_[lane].pop_front();
+
+            if (lane == low_lane) {
+                low_lane_passes_ = 0;
+            } else if (!message_lanes_[low_lane].empty()) {
+                ++low_lane_passes_;
+            }
+        }
+
+        pending_messages_.fetch_sub(1, std::memory_order_relaxed);
+        delivery();
+    }
     template<MessageType T>
     void process_message(T data) {
-        std::lock_guard<std::mutex> lock(handlers_mutex_);
         auto type_id = std::type_index(typeid(T));
 
+        static auto& messages_delivered =
+            MetricsRegistry::instance().counter("messaging.messages_delivered");
+        messages_delivered.increment();
+
+        // A coroutine awaiting this type consumes the message; resume it
+        // outside the lock since it may subscribe or await again
+        std::function<void(std::any)> receiver;
+        {
+            std::lock_guard<std::mutex> lock(handlers_mutex_);
+            if (auto it = pending_receivers_.find(type_id);
+                it != pending_receivers_.end() && !it->second.empty()) {
+                receiver = std::move(it->second.front());
+                it->second.pop_front();
+            }
+        }
+        if (receiver) {
+            receiver(std::any(std::move(data)));
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(handlers_mutex_);
         if (auto it = handlers_.find(type_id); it != handlers_.end()) {
             std::any any_data = std::move(data);
             it->second(any_data);
@@ -164,6 +587,12 @@ private:
 
     mutable std::mutex handlers_mutex_;
     std::unordered_map<std::type_index, std::function<void(const std::any&)>> handlers_;
+    std::unordered_map<std::type_index, std::deque<std::function<void(std::any)>>> pending_receivers_;
+    std::atomic<std::size_t> pending_messages_{0};
+
+    std::mutex lanes_mutex_;
+    std::array<std::deque<std::function<void()>>, MESSAGE_LANE_COUNT> message_lanes_;
+    std::size_t low_lane_passes_{0};
 };
 
 /**
@@ -192,12 +621,150 @@ public:
 
     /**
      * @brief Unregister a thread
+     *
+     * Also removes the thread from every topic it subscribed to.
      */
     void unregister_thread(const std::string& thread_name) {
         std::lock_guard<std::mutex> lock(mutex_);
-        if (!shutdown_.load(std::memory_order_acquire)) {
-            contexts_.erase(thread_name);
+        if (shutdown_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        auto it = contexts_.find(thread_name);
+        if (it == contexts_.end()) {
+            return;
+        }
+        auto removed = it->second;
+        contexts_.erase(it);
+
+        auto current = topics_.load(std::memory_order_acquire);
+        if (!current) {
+            return;
+        }
+        auto updated = std::make_shared<TopicMap>(*current);
+        for (auto topic_it = updated->begin(); topic_it != updated->end();) {
+            auto& subscribers = topic_it->second;
+            std::erase(subscribers, removed);
+            if (subscribers.empty()) {
+                topic_it = updated->erase(topic_it);
+            } else {
+                ++topic_it;
+            }
+        }
+        topics_.store(std::shared_ptr<const TopicMap>(std::move(updated)),
+                      std::memory_order_release);
+    }
+
+    /**
+     * @brief Subscribe a registered thread to a topic
+     * @param topic Topic name
+     * @param thread_name Name the thread registered under
+     * @return true if the thread is registered and now subscribed
+     *
+     * Subscription rebuilds an immutable copy-on-write snapshot of the
+     * topic table, so publish() never takes the bus mutex.
+     */
+    bool subscribe_topic(const std::string& topic, const std::string& thread_name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        auto it = contexts_.find(thread_name);
+        if (it == contexts_.end()) {
+            return false;
+        }
+
+        auto current = topics_.load(std::memory_order_acquire);
+        auto updated = current ? std::make_shared<TopicMap>(*current)
+                               : std::make_shared<TopicMap>();
+        auto& subscribers = (*updated)[topic];
+        if (std::find(subscribers.begin(), subscribers.end(), it->second) !=
+            subscribers.end()) {
+            return true;  // Already subscribed
         }
+        subscribers.push_back(it->second);
+        topics_.store(std::shared_ptr<const TopicMap>(std::move(updated)),
+                      std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove a thread's subscription to a topic
+     */
+    void unsubscribe_topic(const std::string& topic, const std::string& thread_name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        auto context_it = contexts_.find(thread_name);
+        auto current = topics_.load(std::memory_order_acquire);
+        if (context_it == contexts_.end() || !current || !current->contains(topic)) {
+            return;
+        }
+
+        auto updated = std::make_shared<TopicMap>(*current);
+        auto& subscribers = (*updated)[topic];
+        std::erase(subscribers, context_it->second);
+        if (subscribers.empty()) {
+            updated->erase(topic);
+        }
+        topics_.store(std::shared_ptr<const TopicMap>(std::move(updated)),
+                      std::memory_order_release);
+    }
+
+    /**
+     * @brief Publish a shared payload to every subscriber of a topic
+     * @param topic Topic name
+     * @param payload Shared payload; subscribers receive a
+     *        std::shared_ptr<const T> message, so delivery to N threads
+     *        bumps a refcount N times and never copies T
+     * @param priority Delivery lane on each subscriber thread
+     * @return Number of subscriber threads the payload was posted to
+     *
+     * The subscriber list is read from an RCU-style immutable snapshot
+     * without taking the bus mutex, so publishers never contend with
+     * each other or with thread registration. Subscribers receive the
+     * message via their normal handler machinery:
+     * @code
+     * context->subscribe<std::shared_ptr<const MarketEvent>>(
+     *     [](const std::shared_ptr<const MarketEvent>& event) { ... });
+     * bus.publish("market", std::make_shared<const MarketEvent>(...));
+     * @endcode
+     */
+    template<MessageType T>
+    std::size_t publish(const std::string& topic, std::shared_ptr<const T> payload,
+                        MessagePriority priority = MessagePriority::Normal) {
+        auto snapshot = topics_.load(std::memory_order_acquire);
+        if (!snapshot) {
+            return 0;
+        }
+
+        auto it = snapshot->find(topic);
+        if (it == snapshot->end()) {
+            return 0;
+        }
+
+        std::size_t delivered = 0;
+        for (const auto& subscriber : it->second) {
+            if (subscriber->send_message(std::shared_ptr<const T>(payload), priority)) {
+                ++delivered;
+            }
+        }
+        return delivered;
+    }
+
+    /**
+     * @brief Number of threads subscribed to a topic
+     */
+    std::size_t topic_subscriber_count(const std::string& topic) const {
+        auto snapshot = topics_.load(std::memory_order_acquire);
+        if (!snapshot) {
+            return 0;
+        }
+        auto it = snapshot->find(topic);
+        return it != snapshot->end() ? it->second.size() : 0;
     }
 
     /**
@@ -263,6 +830,7 @@ public:
         std::lock_guard<std::mutex> lock(mutex_);
         shutdown_.store(true, std::memory_order_release);
         contexts_.clear();
+        topics_.store(nullptr, std::memory_order_release);
     }
 
 private:
@@ -271,9 +839,17 @@ private:
         shutdown();
     }
 
+    using TopicMap =
+        std::unordered_map<std::string,
+                           std::vector<std::shared_ptr<ThreadMessagingContext>>>;
+
     mutable std::mutex mutex_;
     std::atomic<bool> shutdown_{false};
     std::unordered_map<std::string, std::shared_ptr<ThreadMessagingContext>> contexts_;
+
+    // Copy-on-write topic table: mutations (under mutex_) publish a new
+    // immutable snapshot; publish() only loads the pointer
+    std::atomic<std::shared_ptr<const TopicMap>> topics_;
 };
 
 // Implementation of ThreadMessagingContext methods that depend on InterThreadMessagingBus
@@ -0,0 +1,139 @@
+/*
+ * @file timer_wheel.h
+ * @brief Hashed timer wheel multiplexing delayed and recurring tasks
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <asio.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace base {
+
+/**
+ * @brief Hashed timer wheel that multiplexes many delayed and recurring
+ *        tasks onto a single coarse asio timer
+ *
+ * Instead of a dedicated asio::steady_timer plus a heap-allocated
+ * rescheduling closure per timer, every entry hashes into a fixed array
+ * of slots by expiry tick and one driver timer advances the wheel once
+ * per resolution interval. Insert and cancel are O(1), and the per-slot
+ * vectors and per-tick scratch buffer retain their capacity across
+ * ticks, so a wheel in steady state performs no allocation per tick.
+ *
+ * Resolution is deliberately coarse (default 10ms): a callback fires on
+ * the first tick at or after its deadline, which is the accuracy the
+ * framework's recurring tasks already had. The driver timer is armed
+ * only while entries are pending, so an idle wheel does not keep the
+ * io_context from running out of work.
+ *
+ * All public methods are thread-safe. Callbacks execute on whichever
+ * thread runs the owning io_context and are wrapped in the wheel's
+ * exception guard, matching the framework's task execution semantics.
+ */
+class TimerWheel {
+public:
+    using TimerId = std::size_t;
+    using TimerCallback = std::function<void()>;
+
+    /// Number of wheel slots; power of two so tick-to-slot mapping is a mask
+    static constexpr std::size_t SLOT_COUNT = 512;
+
+    /// Default wheel advance interval
+    static constexpr std::chrono::milliseconds DEFAULT_RESOLUTION{10};
+
+    explicit TimerWheel(asio::io_context& io_context,
+                        std::chrono::milliseconds resolution = DEFAULT_RESOLUTION);
+    ~TimerWheel();
+
+    // Non-copyable, non-movable (the driver timer captures this)
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    /**
+     * @brief Schedule a one-shot callback
+     * @param delay Delay before execution, rounded up to the resolution
+     * @param callback Function to execute
+     * @return Timer ID for cancellation (never 0)
+     */
+    TimerId schedule_once(std::chrono::milliseconds delay, TimerCallback callback);
+
+    /**
+     * @brief Schedule a callback that fires repeatedly at a fixed interval
+     * @param interval Interval between executions, rounded up to the resolution
+     * @param callback Function to execute each tick
+     * @return Timer ID for cancellation (never 0)
+     */
+    TimerId schedule_recurring(std::chrono::milliseconds interval, TimerCallback callback);
+
+    /**
+     * @brief Cancel a scheduled timer
+     * @param id Timer ID returned by schedule_once/schedule_recurring
+     * @return true if the timer was pending and has been cancelled
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * @brief Cancel every pending timer and stop the driver
+     */
+    void cancel_all();
+
+    /**
+     * @brief Number of timers currently pending
+     */
+    std::size_t active_timer_count() const;
+
+    /**
+     * @brief Wheel advance interval
+     */
+    std::chrono::milliseconds resolution() const noexcept { return resolution_; }
+
+private:
+    struct TimerEntry {
+        TimerCallback callback;
+        std::uint64_t deadline_tick{0};
+        std::chrono::milliseconds interval{0};  // zero for one-shot timers
+        std::atomic<bool> cancelled{false};
+    };
+
+    TimerId schedule_entry(std::chrono::milliseconds delay,
+                           std::chrono::milliseconds interval,
+                           TimerCallback callback);
+    std::uint64_t ticks_for(std::chrono::milliseconds duration) const;
+    void insert_unlocked(TimerId id, std::uint64_t deadline_tick);
+    void arm_driver_unlocked();
+    void on_tick();
+
+    asio::steady_timer driver_;
+    const std::chrono::milliseconds resolution_;
+    const std::chrono::steady_clock::time_point epoch_;
+
+    mutable std::mutex mutex_;
+    std::uint64_t current_tick_{0};
+    bool driver_armed_{false};
+    bool stopped_{false};
+    TimerId next_id_{1};
+    std::unordered_map<TimerId, std::shared_ptr<TimerEntry>> entries_;
+    std::array<std::vector<TimerId>, SLOT_COUNT> slots_;
+
+    // Scratch buffers reused by every tick so steady-state ticks do not
+    // allocate; shared_ptr copies into due_entries_ only bump refcounts
+    std::vector<std::shared_ptr<TimerEntry>> due_entries_;
+    std::vector<TimerId> due_ids_;
+};
+
+} // namespace base
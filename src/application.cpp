@@ -8,6 +8,7 @@
 
 #include "application.h"
 #include "cli.h"
+#include "metrics.h"
 
 #include <algorithm>
 #include <csignal>
@@ -345,15 +346,23 @@ bool Application::initialize_internal() {
             return false;
         }
 
-        // Initialize components
-        std::lock_guard<std::mutex> lock(components_mutex_);
-        for (auto& component : components_) {
-            Logger::debug("Initializing component: {}", component->name());
-            if (!component->initialize(*this)) {
-                Logger::error("Failed to initialize component: {}", component->name());
+        // Initialize components wave by wave; independent components in
+        // the same wave initialize concurrently
+        {
+            std::lock_guard<std::mutex> lock(components_mutex_);
+            bool ordered = true;
+            auto waves = component_dependency_waves(ordered);
+            if (!ordered) {
                 return false;
             }
-            Logger::debug("Component '{}' initialized successfully", component->name());
+            for (const auto& wave : waves) {
+                if (!run_component_phase(wave, "initialize",
+                                         [this](ApplicationComponent& component) {
+                                             return component.initialize(*this);
+                                         })) {
+                    return false;
+                }
+            }
         }
 
         Logger::info("Application initialization completed");
@@ -372,16 +381,22 @@ bool Application::start_internal() {
     change_state(ApplicationState::Starting);  // ✅ Starting state is appropriate here
 
     try {
-        // Start components
+        // Start components in the same dependency waves used for
+        // initialization
         {
             std::lock_guard<std::mutex> lock(components_mutex_);
-            for (auto& component : components_) {
-                Logger::debug("Starting component: {}", component->name());
-                if (!component->start()) {
-                    Logger::error("Failed to start component: {}", component->name());
+            bool ordered = true;
+            auto waves = component_dependency_waves(ordered);
+            if (!ordered) {
+                return false;
+            }
+            for (const auto& wave : waves) {
+                if (!run_component_phase(wave, "start",
+                                         [](ApplicationComponent& component) {
+                                             return component.start();
+                                         })) {
                     return false;
                 }
-                Logger::debug("Component '{}' started successfully", component->name());
             }
         }
 
@@ -436,9 +451,7 @@ void Application::stop_internal() {
         {
             std::lock_guard<std::mutex> lock(tasks_mutex_);
             for (auto& task : recurring_tasks_) {
-                if (task.timer) {
-                    task.timer->cancel();
-                }
+                timer_wheel_.cancel(task.wheel_id);
             }
             recurring_tasks_.clear();
         }
@@ -446,19 +459,27 @@ void Application::stop_internal() {
         // Call user shutdown
         on_stop();
 
-        // Stop components in reverse order
+        // Stop components in reverse dependency order: dependents stop
+        // before their dependencies, independent components in parallel.
+        // Stop failures are logged but never abort shutdown, so waves run
+        // to completion even when the graph could not be ordered (a cycle
+        // falls back to reverse registration order in a single wave).
         {
             std::lock_guard<std::mutex> lock(components_mutex_);
-            for (auto it = components_.rbegin(); it != components_.rend(); ++it) {
-                Logger::debug("Stopping component: {}", (*it)->name());
-                try {
-                    if (!(*it)->stop()) {
-                        Logger::warn("Component '{}' reported stop failure", (*it)->name());
-                    }
-                } catch (const std::exception& e) {
-                    Logger::error("Exception stopping component '{}': {}", (*it)->name(), e.what());
+            bool ordered = true;
+            auto waves = component_dependency_waves(ordered);
+            if (!ordered) {
+                waves.clear();
+                waves.emplace_back();
+                for (auto it = components_.rbegin(); it != components_.rend(); ++it) {
+                    waves.back().push_back(it->get());
                 }
-                Logger::debug("Component '{}' stopped", (*it)->name());
+            }
+            for (auto it = waves.rbegin(); it != waves.rend(); ++it) {
+                run_component_phase(*it, "stop",
+                                    [](ApplicationComponent& component) {
+                                        return component.stop();
+                                    });
             }
         }
 
@@ -596,6 +617,25 @@ void Application::handle_signal(int signal) {
 }
 
 void Application::start_worker_threads() {
+    if (config_.enable_work_stealing) {
+        worker_queues_.clear();
+        worker_queues_.reserve(config_.worker_threads);
+        for (std::size_t i = 0; i < config_.worker_threads; ++i) {
+            worker_queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (std::size_t i = 0; i < config_.worker_threads; ++i) {
+            worker_threads_.emplace_back([this, i](std::stop_token stop_token) {
+                try {
+                    run_work_stealing_worker(i, stop_token);
+                } catch (const std::exception& e) {
+                    Logger::error("Exception in worker thread {}: {}", i, e.what());
+                    handle_exception(e);
+                }
+            });
+        }
+        return;
+    }
+
     for (std::size_t i = 0; i < config_.worker_threads; ++i) {
         worker_threads_.emplace_back([this, i](std::stop_token stop_token) {
             try {
@@ -639,57 +679,206 @@ void Application::stop_worker_threads() {
     // Wait for all worker threads to finish (jthread automatically joins on destruction)
     worker_threads_.clear();
 
+    // Drop any local tasks left behind in work-stealing mode, matching
+    // the io_context's semantics for handlers pending at stop
+    worker_queues_.clear();
+
     Logger::debug("All worker threads stopped");
 }
 
+thread_local std::size_t Application::worker_index_ = Application::INVALID_WORKER_INDEX;
+
+void Application::run_work_stealing_worker(std::size_t index, std::stop_token stop_token) {
+    worker_index_ = index;
+
+    // Stop token callback mirrors the shared-context workers: stopping
+    // the io_context wakes any worker sleeping in run_one_for below
+    std::stop_callback stop_callback(stop_token, [this]() {
+        io_context_.stop();
+    });
+
+    Logger::debug("Work-stealing worker {} starting", index);
+
+    while (!stop_token.stop_requested()) {
+        // Lane work, timers and signals dispatch through the io_context;
+        // drain ready handlers first so Critical/High tasks preempt the
+        // local queues
+        io_context_.poll();
+
+        if (try_run_worker_task(index)) {
+            continue;
+        }
+
+        // Nothing local or stealable: sleep on the io_context so the
+        // thread wakes promptly for lane work or a wake-up post
+        io_context_.run_one_for(std::chrono::milliseconds(1));
+    }
+
+    worker_index_ = INVALID_WORKER_INDEX;
+    Logger::debug("Work-stealing worker {} stopping", index);
+}
+
+bool Application::try_run_worker_task(std::size_t index) {
+    QueuedTask task;
+
+    {
+        auto& own = *worker_queues_[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+        }
+    }
+
+    if (!task.function) {
+        // Steal from the back of a busy worker's queue; starting at the
+        // next index spreads victims across thieves
+        auto queue_count = worker_queues_.size();
+        for (std::size_t offset = 1; offset < queue_count && !task.function; ++offset) {
+            auto& victim = *worker_queues_[(index + offset) % queue_count];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.back());
+                victim.tasks.pop_back();
+            }
+        }
+    }
+
+    if (!task.function) {
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        task.function();
+    } catch (const std::exception& e) {
+        Logger::error("Exception in task: {}", e.what());
+    } catch (...) {
+        Logger::error("Unknown exception in task");
+    }
+    task_instrumentation_.record_run(static_cast<std::size_t>(TaskPriority::Normal),
+                                     task.enqueued, start, std::chrono::steady_clock::now(),
+                                     config_.slow_task_threshold, config_.name);
+    return true;
+}
+
 void Application::post_task(TaskFunction task, TaskPriority priority) {
-    // Task posting with priority-based execution strategy
-    switch (priority) {
-        case TaskPriority::Critical:
-            // Critical: Immediate execution when safe, otherwise high-priority queue
-            // Use dispatch but with stack depth protection
-            asio::dispatch(io_context_, [task = std::move(task)]() {
-                try {
-                    task();
-                } catch (const std::exception& e) {
-                    Logger::error("Exception in critical task: {}", e.what());
-                } catch (...) {
-                    Logger::error("Unknown exception in critical task");
-                }
-            });
-            break;
+    auto lane = static_cast<std::size_t>(priority);
+    if (lane >= TASK_LANE_COUNT) {
+        lane = static_cast<std::size_t>(TaskPriority::Normal);
+    }
+
+    auto enqueued = std::chrono::steady_clock::now();
+    task_instrumentation_.record_post(lane);
+
+    static auto& tasks_posted =
+        MetricsRegistry::instance().counter("application.tasks_posted");
+    tasks_posted.increment();
+
+    // Work-stealing mode routes Normal tasks (the bursty fan-out path)
+    // to per-worker queues so dequeues do not contend on the io_context;
+    // other priorities keep their lane ordering guarantees
+    if (config_.enable_work_stealing && !worker_queues_.empty() &&
+        priority == TaskPriority::Normal) {
+        auto target = worker_index_;
+        if (target >= worker_queues_.size()) {
+            target = next_worker_queue_.fetch_add(1, std::memory_order_relaxed) %
+                     worker_queues_.size();
+        }
 
-        case TaskPriority::High:
-            // High: Always use post to avoid stack depth issues, but prioritize
-            // In a real implementation, you'd use a priority queue here
-            asio::post(io_context_, [task = std::move(task)]() {
-                try {
-                    task();
-                } catch (const std::exception& e) {
-                    Logger::error("Exception in high-priority task: {}", e.what());
-                } catch (...) {
-                    Logger::error("Unknown exception in high-priority task");
-                }
-            });
-            break;
+        bool was_empty = false;
+        {
+            auto& queue = *worker_queues_[target];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            was_empty = queue.tasks.empty();
+            queue.tasks.push_back(QueuedTask{std::move(task), enqueued});
+        }
 
-        case TaskPriority::Normal:
-        case TaskPriority::Low:
-        default:
-            // Normal/Low: Standard queued execution
-            asio::post(io_context_, [task = std::move(task), priority]() {
-                try {
-                    task();
-                } catch (const std::exception& e) {
-                    Logger::error("Exception in task (priority {}): {}",
-                                 static_cast<int>(priority), e.what());
-                } catch (...) {
-                    Logger::error("Unknown exception in task (priority {})",
-                                 static_cast<int>(priority));
+        if (was_empty) {
+            // Wake one sleeping worker; a burst pays this only once
+            asio::post(io_context_, []() {});
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lanes_lock(task_lanes_mutex_);
+        task_lanes_[lane].push_back(QueuedTask{std::move(task), enqueued});
+    }
+
+    // Post one pump invocation per enqueued task. asio's own queue is
+    // FIFO, but every pump pops the most urgent task still pending, so a
+    // Critical task submitted behind a long Normal backlog runs on the
+    // very next pump instead of waiting its turn.
+    asio::post(io_context_, [this]() { run_next_prioritized_task(); });
+}
+
+void Application::co_spawn(asio::awaitable<void> task) {
+    asio::co_spawn(io_context_, std::move(task), [](std::exception_ptr e) {
+        if (e) {
+            try {
+                std::rethrow_exception(e);
+            } catch (const std::exception& ex) {
+                Logger::error("Exception in coroutine task: {}", ex.what());
+            } catch (...) {
+                Logger::error("Unknown exception in coroutine task");
+            }
+        }
+    });
+}
+
+void Application::run_next_prioritized_task() {
+    QueuedTask task;
+    TaskPriority priority = TaskPriority::Normal;
+
+    {
+        std::lock_guard<std::mutex> lanes_lock(task_lanes_mutex_);
+
+        constexpr auto low_lane = static_cast<std::size_t>(TaskPriority::Low);
+        std::size_t lane = TASK_LANE_COUNT;
+
+        // Starvation guard: after enough consecutive higher-priority
+        // picks while Low work was pending, service the Low lane first
+        if (low_lane_passes_ >= LOW_LANE_STARVATION_LIMIT &&
+            !task_lanes_[low_lane].empty()) {
+            lane = low_lane;
+        } else {
+            for (std::size_t l = TASK_LANE_COUNT; l-- > 0;) {
+                if (!task_lanes_[l].empty()) {
+                    lane = l;
+                    break;
                 }
-            });
-            break;
+            }
+        }
+
+        if (lane >= TASK_LANE_COUNT) {
+            return;  // Lanes drained by a concurrent pump
+        }
+
+        task = std::move(task_lanes_[lane].front());
+        task_lanes_[lane].pop_front();
+        priority = static_cast<TaskPriority>(lane);
+
+        if (lane == low_lane) {
+            low_lane_passes_ = 0;
+        } else if (!task_lanes_[low_lane].empty()) {
+            ++low_lane_passes_;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        task.function();
+    } catch (const std::exception& e) {
+        Logger::error("Exception in task (priority {}): {}",
+                     static_cast<int>(priority), e.what());
+    } catch (...) {
+        Logger::error("Unknown exception in task (priority {})",
+                     static_cast<int>(priority));
     }
+    task_instrumentation_.record_run(static_cast<std::size_t>(priority), task.enqueued,
+                                     start, std::chrono::steady_clock::now(),
+                                     config_.slow_task_threshold, config_.name);
 }
 
 
@@ -697,16 +886,11 @@ void Application::post_task(TaskFunction task, TaskPriority priority) {
 void Application::post_delayed_task(TaskFunction task,
                                    std::chrono::milliseconds delay,
                                    TaskPriority priority) {
-    auto timer = std::make_shared<asio::steady_timer>(io_context_, delay);
-    timer->async_wait([task = std::move(task), priority, timer](const asio::error_code& ec) {
-        if (!ec) {
-            try {
-                task();
-            } catch (const std::exception& e) {
-                Logger::error("Exception in delayed task (priority {}): {}",
-                             static_cast<int>(priority), e.what());
-            }
-        }
+    // Multiplex onto the shared timer wheel; on expiry the task is routed
+    // through the priority lanes so delayed work competes with directly
+    // posted work on equal terms
+    timer_wheel_.schedule_once(delay, [this, task = std::move(task), priority]() mutable {
+        post_task(std::move(task), priority);
     });
 }
 
@@ -716,21 +900,22 @@ std::size_t Application::schedule_recurring_task(TaskFunction task,
     std::lock_guard<std::mutex> lock(tasks_mutex_);
 
     auto task_id = next_task_id_++;
-    auto timer = std::make_shared<asio::steady_timer>(io_context_);
 
-    auto recurring_task = std::make_shared<RecurringTask>(RecurringTask{
+    // Every recurring task shares the wheel's single driver timer; each
+    // firing is routed through the priority lanes like any posted task
+    auto wheel_id = timer_wheel_.schedule_recurring(
+        interval, [this, task = std::move(task), priority]() {
+            if (state_.load() == ApplicationState::Running) {
+                post_task(task, priority);
+            }
+        });
+
+    recurring_tasks_.push_back(RecurringTask{
         .id = task_id,
-        .timer = timer,
-        .function = std::move(task),
-        .interval = interval,
+        .wheel_id = wheel_id,
         .priority = priority
     });
 
-    recurring_tasks_.push_back(*recurring_task);
-
-    // Start the first execution
-    execute_recurring_task(recurring_task);
-
     Logger::debug("Scheduled recurring task {} with interval {}ms",
                   task_id, interval.count());
 
@@ -746,9 +931,7 @@ void Application::cancel_recurring_task(std::size_t task_id) {
                           });
 
     if (it != recurring_tasks_.end()) {
-        if (it->timer) {
-            it->timer->cancel();
-        }
+        timer_wheel_.cancel(it->wheel_id);
         recurring_tasks_.erase(it);
         Logger::debug("Cancelled recurring task {}", task_id);
     } else {
@@ -756,21 +939,136 @@ void Application::cancel_recurring_task(std::size_t task_id) {
     }
 }
 
-void Application::execute_recurring_task(std::shared_ptr<RecurringTask> task) {
-    task->timer->expires_after(task->interval);
-    task->timer->async_wait([this, task](const asio::error_code& ec) {
-        if (!ec && state_.load() == ApplicationState::Running) {
-            try {
-                task->function();
-            } catch (const std::exception& e) {
-                Logger::error("Exception in recurring task {} (priority {}): {}",
-                             task->id, static_cast<int>(task->priority), e.what());
+void Application::enable_config_hot_reload(std::chrono::milliseconds poll_interval) {
+    if (config_watch_task_id_ != 0) {
+        Logger::warn("Config hot reload already enabled");
+        return;
+    }
+
+    config_watch_task_id_ = schedule_recurring_task(
+        []() { ConfigManager::instance().poll_file_changes(); }, poll_interval);
+
+    Logger::info("Config hot reload enabled (polling every {}ms)", poll_interval.count());
+}
+
+void Application::disable_config_hot_reload() {
+    if (config_watch_task_id_ == 0) {
+        return;
+    }
+
+    cancel_recurring_task(config_watch_task_id_);
+    config_watch_task_id_ = 0;
+    Logger::info("Config hot reload disabled");
+}
+
+std::vector<std::vector<ApplicationComponent*>>
+Application::component_dependency_waves(bool& ok) const {
+    ok = true;
+
+    std::unordered_map<std::string_view, std::size_t> index_by_name;
+    for (std::size_t i = 0; i < components_.size(); ++i) {
+        index_by_name[components_[i]->name()] = i;
+    }
+
+    std::vector<std::size_t> pending_deps(components_.size(), 0);
+    std::vector<std::vector<std::size_t>> dependents(components_.size());
+    for (std::size_t i = 0; i < components_.size(); ++i) {
+        for (auto dep : components_[i]->dependencies()) {
+            auto it = index_by_name.find(dep);
+            if (it == index_by_name.end()) {
+                Logger::warn("Component '{}' depends on unregistered component '{}'",
+                             components_[i]->name(), dep);
+                continue;
             }
+            dependents[it->second].push_back(i);
+            ++pending_deps[i];
+        }
+    }
 
-            // Schedule next execution
-            execute_recurring_task(task);
+    // Kahn's algorithm in waves: everything whose dependencies are all
+    // satisfied forms the next wave, preserving registration order
+    std::vector<std::vector<ApplicationComponent*>> waves;
+    std::vector<std::size_t> current;
+    for (std::size_t i = 0; i < components_.size(); ++i) {
+        if (pending_deps[i] == 0) {
+            current.push_back(i);
         }
-    });
+    }
+
+    std::size_t scheduled = 0;
+    while (!current.empty()) {
+        std::vector<ApplicationComponent*> wave;
+        std::vector<std::size_t> next;
+        for (auto index : current) {
+            wave.push_back(components_[index].get());
+            ++scheduled;
+            for (auto dependent : dependents[index]) {
+                if (--pending_deps[dependent] == 0) {
+                    next.push_back(dependent);
+                }
+            }
+        }
+        waves.push_back(std::move(wave));
+        current = std::move(next);
+    }
+
+    if (scheduled < components_.size()) {
+        for (std::size_t i = 0; i < components_.size(); ++i) {
+            if (pending_deps[i] > 0) {
+                Logger::error("Component dependency cycle involves: {}",
+                              components_[i]->name());
+            }
+        }
+        ok = false;
+        waves.clear();
+    }
+    return waves;
+}
+
+bool Application::run_component_phase(const std::vector<ApplicationComponent*>& wave,
+                                      std::string_view phase,
+                                      const std::function<bool(ApplicationComponent&)>& action) {
+    auto run_one = [&action, phase](ApplicationComponent* component) {
+        Logger::debug("Running {} for component: {}", phase, component->name());
+        try {
+            return action(*component);
+        } catch (const std::exception& e) {
+            Logger::error("Exception during {} of component '{}': {}",
+                          phase, component->name(), e.what());
+            return false;
+        }
+    };
+
+    std::vector<bool> results(wave.size(), false);
+    if (wave.size() == 1) {
+        results[0] = run_one(wave.front());
+    } else {
+        // Independent components run the phase concurrently; the wave
+        // completes before the next one begins
+        std::vector<std::future<bool>> futures;
+        futures.reserve(wave.size());
+        for (auto* component : wave) {
+            futures.push_back(std::async(std::launch::async, run_one, component));
+        }
+        for (std::size_t i = 0; i < futures.size(); ++i) {
+            results[i] = futures[i].get();
+        }
+    }
+
+    bool all_succeeded = true;
+    for (std::size_t i = 0; i < wave.size(); ++i) {
+        if (!results[i]) {
+            all_succeeded = false;
+            if (phase == "stop") {
+                Logger::warn("Component '{}' reported stop failure", wave[i]->name());
+            } else {
+                Logger::error("Failed to {} component: {}", phase, wave[i]->name());
+            }
+        } else {
+            Logger::debug("Component '{}' completed {}", wave[i]->name(), phase);
+        }
+    }
+    return all_succeeded;
 }
 
 void Application::add_component(std::unique_ptr<ApplicationComponent> component) {
@@ -983,7 +1281,14 @@ void Application::ManagedThread::thread_main(std::stop_token stop_token) {
 }
 
 void Application::ManagedThread::post_task(std::function<void()> task) {
-    asio::post(io_context_, [task = std::move(task)]() {
+    constexpr auto lane = static_cast<std::size_t>(TaskPriority::Normal);
+    constexpr std::chrono::milliseconds slow_threshold{100};
+
+    task_instrumentation_.record_post(lane);
+    auto enqueued = std::chrono::steady_clock::now();
+
+    asio::post(io_context_, [this, task = std::move(task), enqueued]() {
+        auto start = std::chrono::steady_clock::now();
         try {
             task();
         } catch (const std::exception& e) {
@@ -991,6 +1296,23 @@ void Application::ManagedThread::post_task(std::function<void()> task) {
         } catch (...) {
             Logger::error("Unknown exception in managed thread task");
         }
+        task_instrumentation_.record_run(lane, enqueued, start,
+                                         std::chrono::steady_clock::now(),
+                                         slow_threshold, name_);
+    });
+}
+
+void Application::ManagedThread::co_spawn(asio::awaitable<void> task) {
+    asio::co_spawn(io_context_, std::move(task), [](std::exception_ptr e) {
+        if (e) {
+            try {
+                std::rethrow_exception(e);
+            } catch (const std::exception& ex) {
+                Logger::error("Exception in managed thread coroutine: {}", ex.what());
+            } catch (...) {
+                Logger::error("Unknown exception in managed thread coroutine");
+            }
+        }
     });
 }
 
@@ -1462,11 +1784,10 @@ bool ThreadedComponent::stop() {
     Logger::info("Stopping ThreadedComponent '{}'", name_);
 
     try {
-        // Cancel all timers
-        for (auto& [timer_id, timer] : timers_) {
-            timer->cancel();
+        // Cancel all timers on this component's wheel
+        if (auto* concrete_thread = concrete_managed_thread()) {
+            concrete_thread->timer_wheel().cancel_all();
         }
-        timers_.clear();
 
         // Request thread stop
         if (managed_thread_) {
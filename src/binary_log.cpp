@@ -0,0 +1,223 @@
+/*
+ * @file binary_log.cpp
+ * @brief Binary structured logging sink implementation and decoder
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "binary_log.h"
+
+#include <fmt/args.h>
+#include <fmt/format.h>
+
+namespace base {
+
+namespace {
+    constexpr std::uint64_t FILE_MAGIC = 0x42415345424c4731ULL;  // "BASEBLG1"
+    constexpr std::uint32_t FILE_VERSION = 1;
+
+    const char* level_name(std::uint8_t level) {
+        switch (static_cast<LogLevel>(level)) {
+            case LogLevel::Trace:    return "TRACE";
+            case LogLevel::Debug:    return "DEBUG";
+            case LogLevel::Info:     return "INFO";
+            case LogLevel::Warn:     return "WARN";
+            case LogLevel::Error:    return "ERROR";
+            case LogLevel::Critical: return "CRITICAL";
+            default:                 return "UNKNOWN";
+        }
+    }
+
+    template<typename T>
+    bool read_raw(std::istream& in, T& value) {
+        return static_cast<bool>(
+            in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+}
+
+BinaryLogSink::BinaryLogSink(std::filesystem::path path,
+                             std::size_t buffer_capacity)
+    : buffer_capacity_(buffer_capacity) {
+    if (auto parent = path.parent_path(); !parent.empty()) {
+        std::filesystem::create_directories(parent);
+    }
+
+    stream_.open(path, std::ios::binary | std::ios::trunc);
+    if (!stream_.is_open()) {
+        Logger::error("Failed to open binary log file '{}'", path.string());
+        return;
+    }
+
+    buffer_.reserve(buffer_capacity_);
+    append_raw(FILE_MAGIC);
+    append_raw(FILE_VERSION);
+}
+
+BinaryLogSink::~BinaryLogSink() {
+    close();
+}
+
+std::uint32_t BinaryLogSink::intern(std::string_view format_string) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = interned_.find(std::string{format_string});
+    if (it != interned_.end()) {
+        return it->second;
+    }
+
+    const auto id = next_format_id_++;
+    interned_.emplace(std::string{format_string}, id);
+
+    // Dictionary record precedes every data record that references it
+    reserve_unlocked(9 + format_string.size());
+    append_u8(RECORD_DICTIONARY);
+    append_raw(id);
+    append_raw(static_cast<std::uint32_t>(format_string.size()));
+    append_bytes(format_string.data(), format_string.size());
+    return id;
+}
+
+void BinaryLogSink::reserve_unlocked(std::size_t size) {
+    if (buffer_.size() + size > buffer_capacity_ && !buffer_.empty()) {
+        flush_unlocked();
+    }
+}
+
+void BinaryLogSink::flush_unlocked() {
+    if (!buffer_.empty() && stream_.is_open()) {
+        stream_.write(reinterpret_cast<const char*>(buffer_.data()),
+                      static_cast<std::streamsize>(buffer_.size()));
+        buffer_.clear();
+    }
+}
+
+void BinaryLogSink::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flush_unlocked();
+    stream_.flush();
+}
+
+void BinaryLogSink::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flush_unlocked();
+    if (stream_.is_open()) {
+        stream_.close();
+    }
+}
+
+bool BinaryLogSink::decode_file(const std::filesystem::path& path,
+                                std::ostream& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        Logger::error("Cannot open binary log file '{}'", path.string());
+        return false;
+    }
+
+    std::uint64_t magic = 0;
+    std::uint32_t version = 0;
+    if (!read_raw(in, magic) || !read_raw(in, version) || magic != FILE_MAGIC) {
+        Logger::error("'{}' is not a base binary log file", path.string());
+        return false;
+    }
+
+    std::unordered_map<std::uint32_t, std::string> dictionary;
+
+    std::uint8_t record_type = 0;
+    while (read_raw(in, record_type)) {
+        if (record_type == RECORD_DICTIONARY) {
+            std::uint32_t id = 0;
+            std::uint32_t length = 0;
+            if (!read_raw(in, id) || !read_raw(in, length)) {
+                return false;
+            }
+            std::string format_string(length, '\0');
+            if (!in.read(format_string.data(), length)) {
+                return false;
+            }
+            dictionary.emplace(id, std::move(format_string));
+            continue;
+        }
+
+        if (record_type != RECORD_DATA) {
+            Logger::error("Corrupt record type {} in '{}'", record_type,
+                          path.string());
+            return false;
+        }
+
+        std::uint32_t format_id = 0;
+        std::uint8_t level = 0;
+        std::uint8_t argc = 0;
+        std::uint64_t timestamp_ns = 0;
+        if (!read_raw(in, format_id) || !read_raw(in, level) ||
+            !read_raw(in, argc) || !read_raw(in, timestamp_ns)) {
+            return false;
+        }
+
+        fmt::dynamic_format_arg_store<fmt::format_context> arguments;
+        for (std::uint8_t i = 0; i < argc; ++i) {
+            std::uint8_t tag = 0;
+            if (!read_raw(in, tag)) {
+                return false;
+            }
+            switch (tag) {
+                case FIELD_BOOL: {
+                    std::uint8_t value = 0;
+                    if (!read_raw(in, value)) return false;
+                    arguments.push_back(value != 0);
+                    break;
+                }
+                case FIELD_INT: {
+                    std::int64_t value = 0;
+                    if (!read_raw(in, value)) return false;
+                    arguments.push_back(value);
+                    break;
+                }
+                case FIELD_UINT: {
+                    std::uint64_t value = 0;
+                    if (!read_raw(in, value)) return false;
+                    arguments.push_back(value);
+                    break;
+                }
+                case FIELD_DOUBLE: {
+                    double value = 0.0;
+                    if (!read_raw(in, value)) return false;
+                    arguments.push_back(value);
+                    break;
+                }
+                case FIELD_STRING: {
+                    std::uint32_t length = 0;
+                    if (!read_raw(in, length)) return false;
+                    std::string value(length, '\0');
+                    if (!in.read(value.data(), length)) return false;
+                    arguments.push_back(value);
+                    break;
+                }
+                default:
+                    Logger::error("Corrupt field tag {} in '{}'", tag,
+                                  path.string());
+                    return false;
+            }
+        }
+
+        auto dict_it = dictionary.find(format_id);
+        if (dict_it == dictionary.end()) {
+            Logger::error("Unknown format id {} in '{}'", format_id,
+                          path.string());
+            return false;
+        }
+
+        try {
+            out << fmt::format("[{}] [{}] {}\n", timestamp_ns, level_name(level),
+                               fmt::vformat(dict_it->second, arguments));
+        } catch (const fmt::format_error& e) {
+            Logger::error("Format error decoding '{}': {}", path.string(),
+                          e.what());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace base
@@ -9,6 +9,7 @@
 #include "cli.h"
 #include "application.h"
 #include "config.h"
+#include "metrics.h"
 #include "thread_messaging.h"
 
 #include <asio/ip/tcp.hpp>
@@ -168,6 +169,9 @@ void CLI::initialize_builtin_commands() {
     register_command("messaging", "Show messaging statistics", "messaging [--detail]",
                     [this](const CLIContext& ctx) { return cmd_messaging(ctx); });
 
+    register_command("metrics", "Show metrics registry snapshot", "metrics [--reset]",
+                    [this](const CLIContext& ctx) { return cmd_metrics(ctx); }, false);
+
     register_command("log-level", "Change log level", "log-level <level>",
                     [this](const CLIContext& ctx) { return cmd_log_level(ctx); }, false);
 
@@ -346,6 +350,16 @@ void CLI::handle_tcp_client(std::shared_ptr<asio::ip::tcp::socket> socket) {
 
             // Execute command
             auto result = execute_command(line);
+
+            if (result.is_streaming()) {
+                // Write each chunk as it is produced instead of building
+                // the full response; a 3M-row table dump stays at one
+                // page of memory and starts arriving immediately
+                stream_result_output(result, [&socket](const std::string& chunk) {
+                    asio::write(*socket, asio::buffer(chunk));
+                });
+            }
+
             std::string response;
 
             if (!result.output.empty()) {
@@ -390,6 +404,13 @@ void CLI::process_commands(std::istream& input, std::ostream& output, bool promp
 
             auto result = execute_command(line);
 
+            if (result.is_streaming()) {
+                stream_result_output(result, [&output](const std::string& chunk) {
+                    output << chunk;
+                    output.flush();
+                });
+            }
+
             if (!result.output.empty()) {
                 output << result.output << std::endl;
             }
@@ -410,6 +431,26 @@ void CLI::process_commands(std::istream& input, std::ostream& output, bool promp
     }
 }
 
+void CLI::stream_result_output(CLIResult& result,
+                               const std::function<void(const std::string&)>& write_chunk) {
+    std::string chunk;
+
+    try {
+        while (running_.load() && result.output_producer(chunk)) {
+            if (!chunk.empty()) {
+                write_chunk(chunk);
+            }
+            chunk.clear();
+        }
+    } catch (const std::exception& e) {
+        Logger::error("CLI streaming output error: {}", e.what());
+        result.success = false;
+        result.error_message = "Output stream aborted: " + std::string(e.what());
+    }
+
+    result.output_producer = nullptr;
+}
+
 CLIResult CLI::execute_with_timeout(std::function<CLIResult()> func, std::chrono::milliseconds timeout) {
     auto future = std::async(std::launch::async, func);
 
@@ -580,6 +621,45 @@ CLIResult CLI::cmd_messaging(const CLIContext& context) {
     return CLIResult::ok(oss.str());
 }
 
+CLIResult CLI::cmd_metrics(const CLIContext& context) {
+    auto samples = MetricsRegistry::instance().snapshot();
+
+    std::ostringstream oss;
+    oss << "Metrics\n";
+    oss << "=======\n";
+
+    if (samples.empty()) {
+        oss << "No metrics registered\n";
+        return CLIResult::ok(oss.str());
+    }
+
+    for (const auto& sample : samples) {
+        oss << std::left << std::setw(40) << sample.name << " ";
+        switch (sample.kind) {
+            case MetricSample::Kind::Counter:
+                oss << "counter    " << sample.value << "\n";
+                break;
+            case MetricSample::Kind::Gauge:
+                oss << "gauge      " << sample.value << "\n";
+                break;
+            case MetricSample::Kind::Histogram:
+                oss << "histogram  count=" << sample.count
+                    << " sum=" << sample.sum
+                    << " p50=" << sample.p50
+                    << " p90=" << sample.p90
+                    << " p99=" << sample.p99 << "\n";
+                break;
+        }
+    }
+
+    if (context.has_option("reset")) {
+        MetricsRegistry::instance().reset();
+        oss << "\nMetrics reset\n";
+    }
+
+    return CLIResult::ok(oss.str());
+}
+
 CLIResult CLI::cmd_log_level(const CLIContext& context) {
     if (context.args.size() < 2) {
         std::ostringstream oss;
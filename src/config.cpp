@@ -13,6 +13,65 @@
 
 namespace base {
 
+namespace {
+
+// Leaf value comparison via typed extraction; toml++ nodes of different
+// types yield disjoint optionals, so any mismatch reads as a change.
+// Temporal values need their own extractions: the four scalar ones all
+// come back nullopt for dates and times, which would make any two
+// temporal nodes compare equal
+bool leaf_equal(const toml::node& a, const toml::node& b) {
+    return a.value<std::string>() == b.value<std::string>() &&
+           a.value<int64_t>() == b.value<int64_t>() &&
+           a.value<double>() == b.value<double>() &&
+           a.value<bool>() == b.value<bool>() &&
+           a.value<toml::date>() == b.value<toml::date>() &&
+           a.value<toml::time>() == b.value<toml::time>() &&
+           a.value<toml::date_time>() == b.value<toml::date_time>();
+}
+
+bool nodes_equal(const toml::node& a, const toml::node& b);
+
+// Arrays are treated as single values: any elementwise difference marks
+// the whole key as modified
+bool array_equal(const toml::array& a, const toml::array& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    auto it_a = a.begin();
+    auto it_b = b.begin();
+    for (; it_a != a.end() && it_b != b.end(); ++it_a, ++it_b) {
+        if (!nodes_equal(*it_a, *it_b)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool nodes_equal(const toml::node& a, const toml::node& b) {
+    if (a.is_array() || b.is_array()) {
+        if (!a.is_array() || !b.is_array()) {
+            return false;
+        }
+        return array_equal(*a.as_array(), *b.as_array());
+    }
+    if (a.is_table() || b.is_table()) {
+        // Tables are diffed key-by-key, never compared as values; inside
+        // arrays we conservatively report them as changed
+        return false;
+    }
+    return leaf_equal(a, b);
+}
+
+std::string join_key(const std::string& prefix, std::string_view key) {
+    if (prefix.empty()) {
+        return std::string(key);
+    }
+    return prefix + "." + std::string(key);
+}
+
+} // namespace
+
 bool ConfigManager::load_config(const std::filesystem::path& config_path,
                                 std::string_view app_name,
                                 const std::source_location& location) {
@@ -27,8 +86,17 @@ bool ConfigManager::load_config(const std::filesystem::path& config_path,
         auto config = toml::parse_file(config_path.string());
         last_config_path_ = config_path;
 
-        // Clear existing configs for this app
+        std::error_code ec;
+        last_write_time_ = std::filesystem::last_write_time(config_path, ec);
+
+        // Keep the previous table so the reload can be diffed against it
         std::string app_key(app_name);
+        toml::table old_table;
+        bool had_old = false;
+        if (auto old_it = app_configs_.find(app_key); old_it != app_configs_.end()) {
+            old_table = std::move(old_it->second);
+            had_old = true;
+        }
         app_configs_.erase(app_key);
 
         // Check if we have app-specific configuration
@@ -46,6 +114,14 @@ bool ConfigManager::load_config(const std::filesystem::path& config_path,
             Logger::info("Loaded root configuration as app '{}' from {}", app_name, config_path.string());
         }
 
+        std::vector<ConfigChange> changes;
+        if (had_old) {
+            diff_tables(app_name, "", old_table, app_configs_[app_key], changes);
+        }
+
+        lock.unlock();
+        refresh_bindings();
+        notify_changes(changes);
         return true;
     } catch (const toml::parse_error& e) {
         Logger::error("TOML parse error in {}: {}", config_path.string(), e.description());
@@ -65,8 +141,14 @@ bool ConfigManager::load_from_string(std::string_view toml_content,
         auto config = toml::parse(toml_content);
         last_config_path_.clear(); // No file path for string content
 
-        // Clear existing configs for this app
+        // Keep the previous table so the reload can be diffed against it
         std::string app_key(app_name);
+        toml::table old_table;
+        bool had_old = false;
+        if (auto old_it = app_configs_.find(app_key); old_it != app_configs_.end()) {
+            old_table = std::move(old_it->second);
+            had_old = true;
+        }
         app_configs_.erase(app_key);
 
         // Check if we have app-specific configuration
@@ -84,6 +166,14 @@ bool ConfigManager::load_from_string(std::string_view toml_content,
             Logger::info("Loaded root configuration as app '{}' from string", app_name);
         }
 
+        std::vector<ConfigChange> changes;
+        if (had_old) {
+            diff_tables(app_name, "", old_table, app_configs_[app_key], changes);
+        }
+
+        lock.unlock();
+        refresh_bindings();
+        notify_changes(changes);
         return true;
     } catch (const toml::parse_error& e) {
         Logger::error("TOML parse error: {}", e.description());
@@ -222,6 +312,45 @@ bool ConfigManager::create_config_template(const std::filesystem::path& config_p
     }
 }
 
+std::size_t ConfigManager::subscribe_changes(ConfigChangeHandler handler) {
+    std::lock_guard<std::mutex> lock(change_handlers_mutex_);
+    std::size_t id = next_change_handler_id_++;
+    change_handlers_[id] = std::move(handler);
+    return id;
+}
+
+void ConfigManager::unsubscribe_changes(std::size_t id) {
+    std::lock_guard<std::mutex> lock(change_handlers_mutex_);
+    change_handlers_.erase(id);
+}
+
+bool ConfigManager::poll_file_changes() {
+    std::filesystem::path config_path;
+    std::filesystem::file_time_type last_seen;
+    {
+        std::shared_lock lock(config_mutex_);
+        if (last_config_path_.empty()) {
+            return false;
+        }
+        config_path = last_config_path_;
+        last_seen = last_write_time_;
+    }
+
+    std::error_code ec;
+    auto current = std::filesystem::last_write_time(config_path, ec);
+    if (ec) {
+        Logger::warn("Cannot stat config file {}: {}", config_path.string(), ec.message());
+        return false;
+    }
+    if (current == last_seen) {
+        return false;
+    }
+
+    Logger::info("Config file {} changed on disk, reloading", config_path.string());
+    reload_config();
+    return true;
+}
+
 bool ConfigManager::reload_config() {
     if (last_config_path_.empty()) {
         Logger::warn("No config file path stored, cannot reload");
@@ -242,9 +371,100 @@ bool ConfigManager::reload_config() {
 }
 
 void ConfigManager::clear() {
-    std::unique_lock lock(config_mutex_);
-    app_configs_.clear();
-    last_config_path_.clear();
+    {
+        std::unique_lock lock(config_mutex_);
+        app_configs_.clear();
+        last_config_path_.clear();
+    }
+    // Snapshots fall back to the defaults their from_config provides
+    refresh_bindings();
+}
+
+void ConfigManager::refresh_bindings() {
+    std::lock_guard<std::mutex> lock(bindings_mutex_);
+    std::erase_if(binding_refreshers_,
+                  [](const std::function<bool()>& refresh) { return !refresh(); });
+}
+
+void ConfigManager::diff_tables(std::string_view app_name, const std::string& prefix,
+                                const toml::table& old_table,
+                                const toml::table& new_table,
+                                std::vector<ConfigChange>& changes) {
+    // Removed and modified keys
+    for (const auto& [key, value] : old_table) {
+        const std::string dotted = join_key(prefix, std::string_view{key});
+        const toml::node* new_node = new_table.get(std::string_view{key});
+        if (!new_node) {
+            if (value.is_table()) {
+                collect_keys(app_name, dotted, *value.as_table(),
+                             ConfigChange::Type::Removed, changes);
+            } else {
+                changes.push_back({std::string(app_name), dotted, ConfigChange::Type::Removed});
+            }
+            continue;
+        }
+        if (value.is_table() && new_node->is_table()) {
+            diff_tables(app_name, dotted, *value.as_table(), *new_node->as_table(), changes);
+        } else if (value.is_table() || new_node->is_table()) {
+            // Leaf replaced by a table (or vice versa)
+            changes.push_back({std::string(app_name), dotted, ConfigChange::Type::Modified});
+        } else if (!nodes_equal(value, *new_node)) {
+            changes.push_back({std::string(app_name), dotted, ConfigChange::Type::Modified});
+        }
+    }
+
+    // Added keys
+    for (const auto& [key, value] : new_table) {
+        if (!old_table.get(std::string_view{key})) {
+            const std::string dotted = join_key(prefix, std::string_view{key});
+            if (value.is_table()) {
+                collect_keys(app_name, dotted, *value.as_table(),
+                             ConfigChange::Type::Added, changes);
+            } else {
+                changes.push_back({std::string(app_name), dotted, ConfigChange::Type::Added});
+            }
+        }
+    }
+}
+
+void ConfigManager::collect_keys(std::string_view app_name, const std::string& prefix,
+                                 const toml::table& table, ConfigChange::Type type,
+                                 std::vector<ConfigChange>& changes) {
+    for (const auto& [key, value] : table) {
+        const std::string dotted = join_key(prefix, std::string_view{key});
+        if (value.is_table()) {
+            collect_keys(app_name, dotted, *value.as_table(), type, changes);
+        } else {
+            changes.push_back({std::string(app_name), dotted, type});
+        }
+    }
+}
+
+void ConfigManager::notify_changes(const std::vector<ConfigChange>& changes) {
+    if (changes.empty()) {
+        return;
+    }
+
+    // Copy handlers so callbacks can subscribe/unsubscribe without deadlock
+    std::vector<ConfigChangeHandler> handlers;
+    {
+        std::lock_guard<std::mutex> lock(change_handlers_mutex_);
+        handlers.reserve(change_handlers_.size());
+        for (const auto& [_, handler] : change_handlers_) {
+            handlers.push_back(handler);
+        }
+    }
+
+    for (const auto& change : changes) {
+        for (const auto& handler : handlers) {
+            try {
+                handler(change);
+            } catch (const std::exception& e) {
+                Logger::error("Config change handler threw for key '{}': {}",
+                              change.key, e.what());
+            }
+        }
+    }
 }
 
 // Private helper methods
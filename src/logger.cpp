@@ -8,7 +8,9 @@
 
 #include <logger.h>
 #include <config.h>
+#include <metrics.h>
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/basic_file_sink.h>
@@ -19,6 +21,7 @@
 namespace base {
 
 std::shared_ptr<spdlog::logger> Logger::s_logger{nullptr};
+std::shared_ptr<spdlog::details::thread_pool> Logger::s_thread_pool{nullptr};
 
 // Component filtering state
 bool Logger::s_component_logging_enabled = true;
@@ -82,10 +85,39 @@ void Logger::init(const LoggerConfig& config) {
     }
 
     // Create logger with sinks
-    s_logger = std::make_shared<spdlog::logger>(config.app_name, sinks.begin(), sinks.end());
+    if (config.enable_async) {
+        // Hot-path log calls become a bounded-time enqueue into a
+        // preallocated ring; a dedicated worker thread pays the
+        // formatting and sink I/O. A fresh pool per init lets queue
+        // size changes take effect (the old pool drains and joins its
+        // worker on destruction).
+        s_thread_pool = std::make_shared<spdlog::details::thread_pool>(
+            std::max<std::size_t>(config.async_queue_size, 1), 1);
+
+        const auto overflow_policy =
+            config.async_overflow_policy == AsyncOverflowPolicy::DropOldest
+                ? spdlog::async_overflow_policy::overrun_oldest
+                : spdlog::async_overflow_policy::block;
+
+        s_logger = std::make_shared<spdlog::async_logger>(
+            config.app_name, sinks.begin(), sinks.end(), s_thread_pool,
+            overflow_policy);
+    } else {
+        s_thread_pool.reset();
+        s_logger = std::make_shared<spdlog::logger>(config.app_name, sinks.begin(), sinks.end());
+    }
     s_logger->set_level(to_spdlog_level(config.level));
     s_logger->flush_on(spdlog::level::err);
 
+    // Export async drops through the metrics registry; evaluated at
+    // snapshot time, so the hot logging path is untouched. Registered
+    // once even when init() runs again with a new configuration.
+    static const std::size_t overrun_provider =
+        MetricsRegistry::instance().register_provider(
+            "logger.async_overrun",
+            []() { return static_cast<std::int64_t>(Logger::async_overrun_count()); });
+    (void)overrun_provider;
+
     // Register with spdlog for global access
     spdlog::register_logger(s_logger);
 }
@@ -132,6 +164,12 @@ void Logger::shutdown() noexcept {
         spdlog::drop(s_logger->name());
         s_logger.reset();
     }
+    // Drains remaining async messages and joins the worker thread
+    s_thread_pool.reset();
+}
+
+std::size_t Logger::async_overrun_count() noexcept {
+    return s_thread_pool ? s_thread_pool->overrun_counter() : 0;
 }
 
 spdlog::level::level_enum Logger::to_spdlog_level(LogLevel level) noexcept {
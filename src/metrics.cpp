@@ -0,0 +1,156 @@
+/*
+ * @file metrics.cpp
+ * @brief Process-wide low-overhead metrics registry implementation
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "metrics.h"
+
+#include <algorithm>
+
+namespace base {
+
+std::uint64_t Histogram::percentile(double fraction) const noexcept {
+    fraction = std::clamp(fraction, 0.0, 1.0);
+
+    std::uint64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+
+    auto rank = static_cast<std::uint64_t>(fraction * static_cast<double>(total));
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += bucket_count(i);
+        if (seen >= rank) {
+            return bucket_upper_bound(i);
+        }
+    }
+    return bucket_upper_bound(BUCKET_COUNT - 1);
+}
+
+void Histogram::reset() noexcept {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+}
+
+Counter& MetricsRegistry::counter(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = counters_[name];
+    if (!slot) {
+        slot = std::make_unique<Counter>();
+    }
+    return *slot;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = gauges_[name];
+    if (!slot) {
+        slot = std::make_unique<Gauge>();
+    }
+    return *slot;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = histograms_[name];
+    if (!slot) {
+        slot = std::make_unique<Histogram>();
+    }
+    return *slot;
+}
+
+std::size_t MetricsRegistry::register_provider(std::string name,
+                                               std::function<std::int64_t()> provider) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t id = next_provider_id_++;
+    providers_.push_back(Provider{id, std::move(name), std::move(provider)});
+    return id;
+}
+
+void MetricsRegistry::unregister_provider(std::size_t id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::erase_if(providers_,
+                  [id](const Provider& provider) { return provider.id == id; });
+}
+
+std::vector<MetricSample> MetricsRegistry::snapshot() const {
+    std::vector<MetricSample> samples;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        samples.reserve(counters_.size() + gauges_.size() + histograms_.size() +
+                        providers_.size());
+
+        for (const auto& [name, counter] : counters_) {
+            MetricSample sample;
+            sample.name = name;
+            sample.kind = MetricSample::Kind::Counter;
+            sample.value = static_cast<std::int64_t>(counter->value());
+            samples.push_back(std::move(sample));
+        }
+
+        for (const auto& [name, gauge] : gauges_) {
+            MetricSample sample;
+            sample.name = name;
+            sample.kind = MetricSample::Kind::Gauge;
+            sample.value = gauge->value();
+            samples.push_back(std::move(sample));
+        }
+
+        for (const auto& [name, histogram] : histograms_) {
+            MetricSample sample;
+            sample.name = name;
+            sample.kind = MetricSample::Kind::Histogram;
+            sample.count = histogram->count();
+            sample.sum = histogram->sum();
+            sample.p50 = histogram->percentile(0.50);
+            sample.p90 = histogram->percentile(0.90);
+            sample.p99 = histogram->percentile(0.99);
+            samples.push_back(std::move(sample));
+        }
+
+        for (const auto& provider : providers_) {
+            MetricSample sample;
+            sample.name = provider.name;
+            sample.kind = MetricSample::Kind::Gauge;
+            try {
+                sample.value = provider.fn();
+            } catch (const std::exception&) {
+                continue;  // A failing provider skips its sample, not the snapshot
+            }
+            samples.push_back(std::move(sample));
+        }
+    }
+
+    std::sort(samples.begin(), samples.end(),
+              [](const MetricSample& a, const MetricSample& b) {
+                  return a.name < b.name;
+              });
+    return samples;
+}
+
+void MetricsRegistry::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [_, counter] : counters_) {
+        counter->reset();
+    }
+    for (auto& [_, gauge] : gauges_) {
+        gauge->reset();
+    }
+    for (auto& [_, histogram] : histograms_) {
+        histogram->reset();
+    }
+}
+
+} // namespace base
@@ -0,0 +1,403 @@
+/*
+ * @file shm_messaging.cpp
+ * @brief Shared-memory cross-process transport implementation
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "shm_messaging.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+namespace base {
+
+namespace {
+    constexpr std::uint64_t RING_MAGIC = 0x62617365'73686d31ULL;  // "base" "shm1"
+
+    // Segment initialization handshake states
+    constexpr std::uint64_t STATE_RAW = 0;           // Fresh zero-filled segment
+    constexpr std::uint64_t STATE_INITIALIZING = 1;  // One process is writing the header
+    constexpr std::uint64_t STATE_READY = 2;
+
+    constexpr std::size_t MIN_CAPACITY = 4096;
+
+    // Records are padded so every record header starts 8-byte aligned
+    constexpr std::size_t align_up(std::size_t size) noexcept {
+        return (size + 7) & ~std::size_t{7};
+    }
+
+    struct RecordHeader {
+        std::uint64_t type_hash;
+        std::uint64_t size;
+    };
+}
+
+/**
+ * @brief Control block at the start of every segment
+ *
+ * head/tail are monotonically increasing byte positions into the data
+ * area; the consumer owns head, the producer owns tail. They sit on
+ * separate cache lines so producer and consumer processes do not
+ * false-share.
+ */
+struct ShmRing::Header {
+    std::atomic<std::uint64_t> state;
+    std::uint64_t magic;
+    std::uint64_t capacity;
+    alignas(64) std::atomic<std::uint64_t> head;
+    alignas(64) std::atomic<std::uint64_t> tail;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "Shared-memory ring cursors require lock-free 64-bit atomics");
+
+ShmRing::~ShmRing() {
+    close();
+}
+
+bool ShmRing::open(const std::string& name, std::size_t capacity) {
+    if (header_ != nullptr) {
+        return true;  // Already open
+    }
+
+    capacity_ = std::bit_ceil(std::max(capacity, MIN_CAPACITY));
+    mask_ = capacity_ - 1;
+    name_ = name;
+
+    fd_ = ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd_ < 0) {
+        Logger::error("Failed to open shared-memory segment '{}': {}", name,
+                      std::strerror(errno));
+        return false;
+    }
+
+    // Only a fresh (zero-length) segment may be sized here; ftruncate on
+    // a live segment would shrink it under a peer that initialized it
+    // larger and SIGBUS that peer on its already-mapped data area
+    struct stat segment_stat {};
+    if (::fstat(fd_, &segment_stat) != 0) {
+        Logger::error("Failed to stat shared-memory segment '{}': {}", name,
+                      std::strerror(errno));
+        close();
+        return false;
+    }
+
+    if (segment_stat.st_size == 0) {
+        mapping_size_ = sizeof(Header) + capacity_;
+        if (::ftruncate(fd_, static_cast<off_t>(mapping_size_)) != 0) {
+            Logger::error("Failed to size shared-memory segment '{}': {}", name,
+                          std::strerror(errno));
+            close();
+            return false;
+        }
+    } else {
+        // Attach to the segment as the initializer sized it; the header
+        // records the ring capacity our mapping must cover
+        mapping_size_ = static_cast<std::size_t>(segment_stat.st_size);
+        if (mapping_size_ < sizeof(Header) + MIN_CAPACITY ||
+            !std::has_single_bit(mapping_size_ - sizeof(Header))) {
+            Logger::error("Shared-memory segment '{}' has unexpected size {}; "
+                          "refusing to attach",
+                          name, mapping_size_);
+            close();
+            return false;
+        }
+        if (mapping_size_ - sizeof(Header) != capacity_) {
+            Logger::warn("Shared-memory segment '{}' was sized for capacity "
+                         "{}; requested {} is ignored",
+                         name, mapping_size_ - sizeof(Header), capacity_);
+        }
+        // Should we end up initializing this segment (e.g. the peer that
+        // sized it died before finishing), the header must describe the
+        // segment as it exists, not as we requested it
+        capacity_ = mapping_size_ - sizeof(Header);
+        mask_ = capacity_ - 1;
+    }
+
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fd_, 0);
+    if (mapping_ == MAP_FAILED) {
+        Logger::error("Failed to map shared-memory segment '{}': {}", name,
+                      std::strerror(errno));
+        mapping_ = nullptr;
+        close();
+        return false;
+    }
+
+    auto* header = static_cast<Header*>(mapping_);
+    data_ = static_cast<unsigned char*>(mapping_) + sizeof(Header);
+
+    // A fresh segment is zero-filled, so whichever process wins the CAS
+    // from STATE_RAW initializes it; the other waits for STATE_READY
+    std::uint64_t expected = STATE_RAW;
+    if (header->state.compare_exchange_strong(expected, STATE_INITIALIZING,
+                                              std::memory_order_acq_rel)) {
+        header->magic = RING_MAGIC;
+        header->capacity = capacity_;
+        header->head.store(0, std::memory_order_relaxed);
+        header->tail.store(0, std::memory_order_relaxed);
+        header->state.store(STATE_READY, std::memory_order_release);
+    } else {
+        for (int spin = 0;
+             header->state.load(std::memory_order_acquire) != STATE_READY; ++spin) {
+            if (spin > 10000) {
+                Logger::error(
+                    "Shared-memory segment '{}' never finished initializing", name);
+                close();
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        if (header->magic != RING_MAGIC) {
+            Logger::error("Shared-memory segment '{}' has foreign contents", name);
+            close();
+            return false;
+        }
+        // The initializing side's capacity wins, but only if our mapping
+        // actually covers it: running the ring through a larger mask
+        // than we mapped would walk off the end of the mapping
+        const auto ring_capacity = static_cast<std::size_t>(header->capacity);
+        if (!std::has_single_bit(ring_capacity) ||
+            sizeof(Header) + ring_capacity > mapping_size_) {
+            Logger::error("Shared-memory segment '{}' declares capacity {} "
+                          "beyond its {}-byte mapping; refusing to attach",
+                          name, ring_capacity, mapping_size_);
+            close();
+            return false;
+        }
+        if (ring_capacity != capacity_) {
+            Logger::warn("Shared-memory segment '{}' was initialized with "
+                         "capacity {}; requested {} is ignored",
+                         name, ring_capacity, capacity_);
+        }
+        capacity_ = ring_capacity;
+        mask_ = capacity_ - 1;
+    }
+
+    header_ = header;
+    return true;
+}
+
+void ShmRing::close() {
+    header_ = nullptr;
+    data_ = nullptr;
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+void ShmRing::unlink(const std::string& name) {
+    ::shm_unlink(name.c_str());
+}
+
+void ShmRing::copy_in(std::uint64_t pos, const void* src, std::size_t size) {
+    const std::size_t offset = static_cast<std::size_t>(pos) & mask_;
+    const std::size_t first = std::min(size, capacity_ - offset);
+    std::memcpy(data_ + offset, src, first);
+    if (first < size) {
+        std::memcpy(data_, static_cast<const unsigned char*>(src) + first,
+                    size - first);
+    }
+}
+
+void ShmRing::copy_out(std::uint64_t pos, void* dst, std::size_t size) const {
+    const std::size_t offset = static_cast<std::size_t>(pos) & mask_;
+    const std::size_t first = std::min(size, capacity_ - offset);
+    std::memcpy(dst, data_ + offset, first);
+    if (first < size) {
+        std::memcpy(static_cast<unsigned char*>(dst) + first, data_, size - first);
+    }
+}
+
+bool ShmRing::write(std::uint64_t type_hash, const void* payload, std::size_t size) {
+    if (header_ == nullptr) {
+        return false;
+    }
+
+    const std::size_t total = sizeof(RecordHeader) + align_up(size);
+    if (total > capacity_) {
+        Logger::error("Shared-memory message of {} bytes exceeds ring capacity {}",
+                      size, capacity_);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    const auto head = header_->head.load(std::memory_order_acquire);
+    const auto tail = header_->tail.load(std::memory_order_relaxed);
+    if (capacity_ - static_cast<std::size_t>(tail - head) < total) {
+        return false;  // Ring full: caller applies backpressure
+    }
+
+    const RecordHeader record{type_hash, size};
+    copy_in(tail, &record, sizeof(record));
+    copy_in(tail + sizeof(record), payload, size);
+    header_->tail.store(tail + total, std::memory_order_release);
+    return true;
+}
+
+std::size_t ShmRing::drain(const RecordSink& sink, std::size_t max_records) {
+    if (header_ == nullptr) {
+        return 0;
+    }
+
+    auto head = header_->head.load(std::memory_order_relaxed);
+    std::size_t consumed = 0;
+    while (consumed < max_records) {
+        const auto tail = header_->tail.load(std::memory_order_acquire);
+        if (head == tail) {
+            break;
+        }
+
+        RecordHeader record;
+        copy_out(head, &record, sizeof(record));
+        const std::size_t total =
+            sizeof(RecordHeader) + align_up(static_cast<std::size_t>(record.size));
+        if (total > capacity_ || head + total > tail) {
+            // Torn or foreign contents; drop everything rather than
+            // feed garbage to handlers
+            Logger::error("Corrupt record in shared-memory segment '{}'; "
+                          "discarding pending data", name_);
+            head = tail;
+            break;
+        }
+
+        const std::size_t offset =
+            static_cast<std::size_t>(head + sizeof(RecordHeader)) & mask_;
+        const unsigned char* payload = nullptr;
+        if (offset + record.size <= capacity_) {
+            payload = data_ + offset;  // Contiguous: no copy needed
+        } else {
+            scratch_.resize(static_cast<std::size_t>(record.size));
+            copy_out(head + sizeof(RecordHeader), scratch_.data(), scratch_.size());
+            payload = scratch_.data();
+        }
+
+        sink(record.type_hash, payload, static_cast<std::size_t>(record.size));
+        head += total;
+        ++consumed;
+    }
+
+    header_->head.store(head, std::memory_order_release);
+    return consumed;
+}
+
+SharedMemoryTransport::SharedMemoryTransport(std::string local_name,
+                                             std::string peer_name,
+                                             asio::io_context& io_context,
+                                             std::size_t ring_capacity,
+                                             std::chrono::microseconds poll_interval)
+    : local_name_(std::move(local_name))
+    , peer_name_(std::move(peer_name))
+    , io_context_(io_context)
+    , ring_capacity_(ring_capacity)
+    , poll_interval_(poll_interval) {}
+
+SharedMemoryTransport::~SharedMemoryTransport() {
+    stop();
+}
+
+std::string SharedMemoryTransport::segment_name(const std::string& from,
+                                                const std::string& to) {
+    std::string name = "/base_shm_" + from + "_to_" + to;
+    // shm_open names may contain no slash beyond the leading one
+    std::replace(name.begin() + 1, name.end(), '/', '_');
+    return name;
+}
+
+bool SharedMemoryTransport::start() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return true;  // Already started
+    }
+
+    if (!send_ring_.open(segment_name(local_name_, peer_name_), ring_capacity_) ||
+        !receive_ring_.open(segment_name(peer_name_, local_name_), ring_capacity_)) {
+        send_ring_.close();
+        receive_ring_.close();
+        running_.store(false, std::memory_order_release);
+        return false;
+    }
+
+    Logger::debug("Shared-memory transport '{}' <-> '{}' started", local_name_,
+                  peer_name_);
+    arm_poll_timer();
+    return true;
+}
+
+void SharedMemoryTransport::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;  // Already stopped
+    }
+
+    poll_timer_.cancel();
+    send_ring_.close();
+    receive_ring_.close();
+    Logger::debug("Shared-memory transport '{}' <-> '{}' stopped", local_name_,
+                  peer_name_);
+}
+
+void SharedMemoryTransport::remove_segments(const std::string& name_a,
+                                            const std::string& name_b) {
+    ShmRing::unlink(segment_name(name_a, name_b));
+    ShmRing::unlink(segment_name(name_b, name_a));
+}
+
+void SharedMemoryTransport::arm_poll_timer() {
+    poll_timer_.expires_after(poll_interval_);
+    poll_timer_.async_wait([this](const asio::error_code& error) {
+        if (!error && running_.load(std::memory_order_acquire)) {
+            poll();
+        }
+    });
+}
+
+void SharedMemoryTransport::poll() {
+    const auto consumed = receive_ring_.drain(
+        [this](std::uint64_t type_hash, const unsigned char* payload,
+               std::size_t size) {
+            std::function<void(const unsigned char*, std::size_t)> handler;
+            {
+                std::lock_guard<std::mutex> lock(handlers_mutex_);
+                if (auto it = handlers_.find(type_hash); it != handlers_.end()) {
+                    handler = it->second;
+                }
+            }
+            if (!handler) {
+                return;  // No subscriber for this type: consume and drop
+            }
+            try {
+                handler(payload, size);
+            } catch (const std::exception& e) {
+                Logger::error("Exception in shared-memory message handler: {}",
+                              e.what());
+            }
+        },
+        MAX_POLL_BATCH);
+
+    if (consumed == MAX_POLL_BATCH) {
+        // More may be pending; yield the event loop and continue promptly
+        asio::post(io_context_, [this]() {
+            if (running_.load(std::memory_order_acquire)) {
+                poll();
+            }
+        });
+        return;
+    }
+    arm_poll_timer();
+}
+
+} // namespace base
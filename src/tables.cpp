@@ -7,16 +7,68 @@
  */
 
 #include "tables.h"
+#include "metrics.h"
 #include <nlohmann/json.hpp>
 #include <algorithm>
+#include <deque>
 #include <iomanip>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <cstring>
 #include <ctime>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace base {
 
+// ColumnRegistry implementation
+namespace {
+
+struct ColumnRegistryState {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string, ColumnId> ids;
+    std::deque<std::string> names;  // Deque keeps name references stable
+};
+
+ColumnRegistryState& column_registry_state() {
+    static ColumnRegistryState state;
+    return state;
+}
+
+} // namespace
+
+ColumnId ColumnRegistry::intern(const std::string& name) {
+    auto& state = column_registry_state();
+
+    {
+        std::shared_lock lock(state.mutex);
+        auto it = state.ids.find(name);
+        if (it != state.ids.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(state.mutex);
+    auto [it, inserted] = state.ids.try_emplace(name, static_cast<ColumnId>(state.names.size()));
+    if (inserted) {
+        state.names.push_back(name);
+    }
+    return it->second;
+}
+
+const std::string& ColumnRegistry::name_of(ColumnId id) {
+    auto& state = column_registry_state();
+    std::shared_lock lock(state.mutex);
+    if (id >= state.names.size()) {
+        throw std::invalid_argument("Unknown column ID: " + std::to_string(id));
+    }
+    return state.names[id];
+}
+
 // TableQuery implementation
 TableQuery& TableQuery::select(const std::vector<std::string>& columns) {
     selected_columns_ = columns;
@@ -33,6 +85,11 @@ TableQuery& TableQuery::where(const std::string& column, QueryOperator op, const
     return *this;
 }
 
+TableQuery& TableQuery::where(ColumnId column, QueryOperator op, const CellValue& value) {
+    conditions_.emplace_back(column, op, value);
+    return *this;
+}
+
 TableQuery& TableQuery::order_by(const std::string& column, bool ascending) {
     order_by_.emplace_back(column, ascending);
     return *this;
@@ -49,20 +106,46 @@ TableQuery& TableQuery::offset(std::size_t count) {
 }
 
 // TableRow implementation
-void TableRow::set_value(const std::string& column, const CellValue& value) {
+void TableRow::set_value(ColumnId column, const CellValue& value) {
     values_[column] = value;
     updated_at_ = std::chrono::system_clock::now();
 }
 
-CellValue TableRow::get_value(const std::string& column) const {
+CellValue TableRow::get_value(ColumnId column) const {
     auto it = values_.find(column);
     return it != values_.end() ? it->second : CellValue{std::monostate{}};
 }
 
-bool TableRow::has_column(const std::string& column) const {
+bool TableRow::has_column(ColumnId column) const {
     return values_.find(column) != values_.end();
 }
 
+const CellValue* TableRow::find_cell(ColumnId column) const {
+    auto it = values_.find(column);
+    return it != values_.end() ? &it->second : nullptr;
+}
+
+void TableRow::set_value(const std::string& column, const CellValue& value) {
+    set_value(ColumnRegistry::intern(column), value);
+}
+
+CellValue TableRow::get_value(const std::string& column) const {
+    return get_value(ColumnRegistry::intern(column));
+}
+
+bool TableRow::has_column(const std::string& column) const {
+    return has_column(ColumnRegistry::intern(column));
+}
+
+std::unordered_map<std::string, CellValue> TableRow::get_all_values() const {
+    std::unordered_map<std::string, CellValue> result;
+    result.reserve(values_.size());
+    for (const auto& [id, value] : values_) {
+        result.emplace(ColumnRegistry::name_of(id), value);
+    }
+    return result;
+}
+
 void TableRow::increment_version() {
     version_++;
     updated_at_ = std::chrono::system_clock::now();
@@ -78,7 +161,8 @@ std::string TableRow::to_json() const {
         updated_at_.time_since_epoch()).count();
 
     nlohmann::json values_json;
-    for (const auto& [key, value] : values_) {
+    for (const auto& [id, value] : values_) {
+        const std::string& key = ColumnRegistry::name_of(id);
         std::visit([&](const auto& v) {
             using T = std::decay_t<decltype(v)>;
             if constexpr (std::is_same_v<T, std::monostate>) {
@@ -117,16 +201,17 @@ bool TableRow::from_json(const std::string& json) {
 
         values_.clear();
         for (const auto& [key, value] : j["values"].items()) {
+            auto id = ColumnRegistry::intern(key);
             if (value.is_null()) {
-                values_[key] = std::monostate{};
+                values_[id] = std::monostate{};
             } else if (value.is_number_integer()) {
-                values_[key] = static_cast<std::int64_t>(value);
+                values_[id] = static_cast<std::int64_t>(value);
             } else if (value.is_number_float()) {
-                values_[key] = static_cast<double>(value);
+                values_[id] = static_cast<double>(value);
             } else if (value.is_string()) {
-                values_[key] = static_cast<std::string>(value);
+                values_[id] = static_cast<std::string>(value);
             } else if (value.is_boolean()) {
-                values_[key] = static_cast<bool>(value);
+                values_[id] = static_cast<bool>(value);
             }
         }
 
@@ -149,6 +234,7 @@ void TableSchema::add_column(const ColumnDefinition& column) {
         }
     }
     columns_.push_back(column);
+    columns_.back().id = ColumnRegistry::intern(column.name);
     increment_version();
 }
 
@@ -170,6 +256,7 @@ void TableSchema::modify_column(const std::string& name, const ColumnDefinition&
 
     if (it != columns_.end()) {
         *it = new_def;
+        it->id = ColumnRegistry::intern(it->name);
         increment_version();
     } else {
         throw std::invalid_argument("Column '" + name + "' not found");
@@ -183,6 +270,13 @@ std::optional<ColumnDefinition> TableSchema::get_column(const std::string& name)
     return it != columns_.end() ? std::optional<ColumnDefinition>(*it) : std::nullopt;
 }
 
+std::optional<ColumnId> TableSchema::get_column_id(const std::string& name) const {
+    auto it = std::find_if(columns_.begin(), columns_.end(),
+        [&name](const ColumnDefinition& col) { return col.name == name; });
+
+    return it != columns_.end() ? std::optional<ColumnId>(it->id) : std::nullopt;
+}
+
 bool TableSchema::validate_row(const TableRow& row) const {
     return get_validation_errors(row).empty();
 }
@@ -191,8 +285,8 @@ std::vector<std::string> TableSchema::get_validation_errors(const TableRow& row)
     std::vector<std::string> errors;
 
     for (const auto& column : columns_) {
-        bool has_value = row.has_column(column.name);
-        CellValue value = row.get_value(column.name);
+        bool has_value = row.has_column(column.id);
+        CellValue value = row.get_value(column.id);
         bool is_null = std::holds_alternative<std::monostate>(value);
 
         // Check not null constraint
@@ -292,6 +386,7 @@ bool TableSchema::from_json(const std::string& json) {
                 }
             }
 
+            column.id = ColumnRegistry::intern(column.name);
             columns_.push_back(column);
         }
 
@@ -309,15 +404,52 @@ std::unique_ptr<TableSchema> TableSchema::evolve(std::uint32_t new_version) cons
     return evolved;
 }
 
+// CellKeyHash implementation
+std::size_t CellKeyHash::operator()(const std::vector<CellValue>& key) const {
+    std::size_t seed = key.size();
+
+    for (const auto& cell : key) {
+        std::size_t h = std::visit([](const auto& v) -> std::size_t {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                return 0;
+            } else if constexpr (std::is_same_v<T, std::chrono::system_clock::time_point>) {
+                return std::hash<std::int64_t>{}(v.time_since_epoch().count());
+            } else if constexpr (std::is_same_v<T, std::vector<std::uint8_t>>) {
+                std::size_t blob_hash = v.size();
+                for (auto byte : v) {
+                    blob_hash = blob_hash * 131 + byte;
+                }
+                return blob_hash;
+            } else {
+                return std::hash<T>{}(v);
+            }
+        }, cell);
+
+        // boost::hash_combine-style mixing
+        seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+
+    return seed;
+}
+
 // TableIndex implementation
-TableIndex::TableIndex(std::string name, std::vector<std::string> columns, bool unique)
-    : name_(std::move(name)), columns_(std::move(columns)), unique_(unique) {}
+TableIndex::TableIndex(std::string name, std::vector<std::string> columns, bool unique,
+                       IndexKind kind)
+    : name_(std::move(name)), columns_(std::move(columns)), unique_(unique), kind_(kind) {
+    column_ids_.reserve(columns_.size());
+    for (const auto& column : columns_) {
+        column_ids_.push_back(ColumnRegistry::intern(column));
+    }
+}
 
 // Copy constructor
 TableIndex::TableIndex(const TableIndex& other)
-    : name_(other.name_), columns_(other.columns_), unique_(other.unique_) {
+    : name_(other.name_), columns_(other.columns_)
+    , column_ids_(other.column_ids_), unique_(other.unique_), kind_(other.kind_) {
     std::shared_lock lock(other.mutex_);
     index_ = other.index_;
+    hash_index_ = other.hash_index_;
 }
 
 // Assignment operator
@@ -329,8 +461,11 @@ TableIndex& TableIndex::operator=(const TableIndex& other) {
 
         name_ = other.name_;
         columns_ = other.columns_;
+        column_ids_ = other.column_ids_;
         unique_ = other.unique_;
+        kind_ = other.kind_;
         index_ = other.index_;
+        hash_index_ = other.hash_index_;
     }
     return *this;
 }
@@ -339,6 +474,14 @@ void TableIndex::insert(const TableRow& row) {
     std::unique_lock lock(mutex_);
     auto key = extract_key(row);
 
+    if (kind_ == IndexKind::Hash) {
+        if (unique_ && hash_index_.find(key) != hash_index_.end()) {
+            throw std::runtime_error("Unique constraint violation in index '" + name_ + "'");
+        }
+        hash_index_[key].insert(row.get_id());
+        return;
+    }
+
     if (unique_ && index_.find(key) != index_.end()) {
         throw std::runtime_error("Unique constraint violation in index '" + name_ + "'");
     }
@@ -349,13 +492,21 @@ void TableIndex::insert(const TableRow& row) {
 void TableIndex::remove(const TableRow& row) {
     std::unique_lock lock(mutex_);
     auto key = extract_key(row);
-    auto it = index_.find(key);
 
-    if (it != index_.end()) {
-        it->second.erase(row.get_id());
-        if (it->second.empty()) {
-            index_.erase(it);
+    auto erase_from = [&](auto& container) {
+        auto it = container.find(key);
+        if (it != container.end()) {
+            it->second.erase(row.get_id());
+            if (it->second.empty()) {
+                container.erase(it);
+            }
         }
+    };
+
+    if (kind_ == IndexKind::Hash) {
+        erase_from(hash_index_);
+    } else {
+        erase_from(index_);
     }
 }
 
@@ -365,25 +516,41 @@ void TableIndex::update(const TableRow& old_row, const TableRow& new_row) {
     auto old_key = extract_key(old_row);
     auto new_key = extract_key(new_row);
 
-    // Remove from old position
-    auto old_it = index_.find(old_key);
-    if (old_it != index_.end()) {
-        old_it->second.erase(old_row.get_id());
-        if (old_it->second.empty()) {
-            index_.erase(old_it);
+    auto reindex = [&](auto& container) {
+        // Remove from old position
+        auto old_it = container.find(old_key);
+        if (old_it != container.end()) {
+            old_it->second.erase(old_row.get_id());
+            if (old_it->second.empty()) {
+                container.erase(old_it);
+            }
         }
-    }
 
-    // Add to new position
-    if (unique_ && new_key != old_key && index_.find(new_key) != index_.end()) {
-        throw std::runtime_error("Unique constraint violation in index '" + name_ + "'");
-    }
+        // Add to new position
+        if (unique_ && new_key != old_key && container.find(new_key) != container.end()) {
+            throw std::runtime_error("Unique constraint violation in index '" + name_ + "'");
+        }
+
+        container[new_key].insert(new_row.get_id());
+    };
 
-    index_[new_key].insert(new_row.get_id());
+    if (kind_ == IndexKind::Hash) {
+        reindex(hash_index_);
+    } else {
+        reindex(index_);
+    }
 }
 
 std::vector<std::size_t> TableIndex::find_exact(const std::vector<CellValue>& key) const {
     std::shared_lock lock(mutex_);
+
+    if (kind_ == IndexKind::Hash) {
+        auto it = hash_index_.find(key);
+        return it != hash_index_.end()
+            ? std::vector<std::size_t>(it->second.begin(), it->second.end())
+            : std::vector<std::size_t>{};
+    }
+
     auto it = index_.find(key);
 
     if (it != index_.end()) {
@@ -395,6 +562,10 @@ std::vector<std::size_t> TableIndex::find_exact(const std::vector<CellValue>& ke
 
 std::vector<std::size_t> TableIndex::find_range(const std::vector<CellValue>& start_key,
                                                const std::vector<CellValue>& end_key) const {
+    if (kind_ == IndexKind::Hash) {
+        throw std::runtime_error("Index '" + name_ + "' is a hash index and does not support range lookups");
+    }
+
     std::shared_lock lock(mutex_);
     std::vector<std::size_t> result;
 
@@ -410,265 +581,1200 @@ std::vector<std::size_t> TableIndex::find_range(const std::vector<CellValue>& st
 
 std::size_t TableIndex::size() const {
     std::shared_lock lock(mutex_);
-    return index_.size();
+    return kind_ == IndexKind::Hash ? hash_index_.size() : index_.size();
 }
 
 void TableIndex::clear() {
     std::unique_lock lock(mutex_);
     index_.clear();
+    hash_index_.clear();
 }
 
 std::vector<CellValue> TableIndex::extract_key(const TableRow& row) const {
     std::vector<CellValue> key;
-    key.reserve(columns_.size());
+    key.reserve(column_ids_.size());
 
-    for (const auto& column : columns_) {
-        key.push_back(row.get_value(column));
+    for (auto column_id : column_ids_) {
+        key.push_back(row.get_value(column_id));
     }
 
     return key;
 }
 
-// TableTransaction implementation
-TableTransaction::TableTransaction(Table* table, std::string id)
-    : table_(table), id_(std::move(id)) {}
-
-TableTransaction::~TableTransaction() {
-    if (active_ && !committed_ && !rolled_back_) {
-        rollback();
-    }
+// ColumnStore implementation
+ColumnStore::ColumnStore(const TableSchema& schema) {
+    rebind_schema(schema);
 }
 
-void TableTransaction::begin() {
-    if (active_) {
-        throw std::runtime_error("Transaction already active");
-    }
-    active_ = true;
-    change_log_.clear();
-}
+void ColumnStore::rebind_schema(const TableSchema& schema) {
+    std::vector<TypedColumn> new_columns;
+    std::unordered_map<std::string, std::size_t> new_positions;
+    new_columns.reserve(schema.get_columns().size());
 
-void TableTransaction::commit() {
-    if (!active_) {
-        throw std::runtime_error("No active transaction");
-    }
-    if (committed_ || rolled_back_) {
-        throw std::runtime_error("Transaction already finalized");
+    for (const auto& definition : schema.get_columns()) {
+        auto it = column_positions_.find(definition.name);
+        if (it != column_positions_.end() && columns_[it->second].type == definition.type) {
+            // Keep existing data for columns that survived the evolution
+            new_columns.push_back(std::move(columns_[it->second]));
+        } else {
+            TypedColumn column;
+            column.name = definition.name;
+            column.id = definition.id;
+            column.type = definition.type;
+            column.resize(slots_.size());
+            new_columns.push_back(std::move(column));
+        }
+        new_positions[definition.name] = new_columns.size() - 1;
     }
 
-    committed_ = true;
-    active_ = false;
-    change_log_.clear();
+    columns_ = std::move(new_columns);
+    column_positions_ = std::move(new_positions);
 }
 
-void TableTransaction::rollback() {
-    if (!active_) {
-        throw std::runtime_error("No active transaction");
-    }
-    if (committed_ || rolled_back_) {
-        throw std::runtime_error("Transaction already finalized");
+void ColumnStore::TypedColumn::resize(std::size_t slots) {
+    nulls.resize(slots, 1);
+    switch (type) {
+        case ColumnType::Integer: integers.resize(slots); break;
+        case ColumnType::Double: doubles.resize(slots); break;
+        case ColumnType::String:
+        case ColumnType::Json: strings.resize(slots); break;
+        case ColumnType::Boolean: booleans.resize(slots); break;
+        case ColumnType::DateTime: timestamps.resize(slots); break;
+        case ColumnType::Binary: blobs.resize(slots); break;
     }
-
-    // Implement rollback logic here
-    // This would reverse all operations in the change log
-
-    rolled_back_ = true;
-    active_ = false;
-    change_log_.clear();
 }
 
-// Table implementation
-Table::Table(std::unique_ptr<TableSchema> schema)
-    : schema_(std::move(schema))
-    , created_at_(std::chrono::system_clock::now())
-    , last_modified_(std::chrono::system_clock::now()) {
+void ColumnStore::TypedColumn::set(std::size_t slot, const CellValue& value) {
+    nulls[slot] = 1;
+    if (std::holds_alternative<std::monostate>(value)) {
+        return;
+    }
 
-    // Create primary key index if defined
-    if (!schema_->get_primary_key().empty()) {
-        create_index("__primary_key", schema_->get_primary_key(), true);
+    switch (type) {
+        case ColumnType::Integer:
+            if (const auto* v = std::get_if<std::int64_t>(&value)) {
+                integers[slot] = *v;
+                nulls[slot] = 0;
+            }
+            break;
+        case ColumnType::Double:
+            if (const auto* v = std::get_if<double>(&value)) {
+                doubles[slot] = *v;
+                nulls[slot] = 0;
+            }
+            break;
+        case ColumnType::String:
+        case ColumnType::Json:
+            if (const auto* v = std::get_if<std::string>(&value)) {
+                strings[slot] = *v;
+                nulls[slot] = 0;
+            }
+            break;
+        case ColumnType::Boolean:
+            if (const auto* v = std::get_if<bool>(&value)) {
+                booleans[slot] = *v ? 1 : 0;
+                nulls[slot] = 0;
+            }
+            break;
+        case ColumnType::DateTime:
+            if (const auto* v = std::get_if<std::chrono::system_clock::time_point>(&value)) {
+                timestamps[slot] = *v;
+                nulls[slot] = 0;
+            }
+            break;
+        case ColumnType::Binary:
+            if (const auto* v = std::get_if<std::vector<std::uint8_t>>(&value)) {
+                blobs[slot] = *v;
+                nulls[slot] = 0;
+            }
+            break;
     }
 }
 
-std::size_t Table::insert_row(const std::unordered_map<std::string, CellValue>& values) {
-    std::unique_lock lock(table_mutex_);
-
-    auto row_id = next_row_id_++;
-    auto row = std::make_unique<TableRow>(row_id);
+CellValue ColumnStore::TypedColumn::get(std::size_t slot) const {
+    if (nulls[slot]) {
+        return std::monostate{};
+    }
 
-    // Set all provided values
-    for (const auto& [column, value] : values) {
-        row->set_value(column, value);
+    switch (type) {
+        case ColumnType::Integer: return integers[slot];
+        case ColumnType::Double: return doubles[slot];
+        case ColumnType::String:
+        case ColumnType::Json: return strings[slot];
+        case ColumnType::Boolean: return static_cast<bool>(booleans[slot]);
+        case ColumnType::DateTime: return timestamps[slot];
+        case ColumnType::Binary: return blobs[slot];
     }
+    return std::monostate{};
+}
 
-    // Validate row
-    if (!schema_->validate_row(*row)) {
-        auto errors = schema_->get_validation_errors(*row);
-        std::string error_msg = "Row validation failed: ";
-        for (const auto& error : errors) {
-            error_msg += error + "; ";
+std::size_t ColumnStore::allocate_slot(std::size_t row_id) {
+    std::size_t slot;
+    if (!free_slots_.empty()) {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    } else {
+        slot = slots_.size();
+        slots_.emplace_back();
+        for (auto& column : columns_) {
+            column.resize(slots_.size());
         }
-        throw std::runtime_error(error_msg);
     }
 
-    // Update indexes
-    update_indexes_on_insert(*row);
-
-    // Store the row
-    rows_[row_id] = std::move(row);
-
-    // Update statistics
-    total_inserts_++;
-    last_modified_ = std::chrono::system_clock::now();
+    slots_[slot] = RowMeta{};
+    slots_[slot].row_id = row_id;
+    slots_[slot].in_use = true;
+    row_slots_[row_id] = slot;
+    return slot;
+}
 
-    // Fire change event
-    ChangeEvent event(ChangeType::RowInserted, schema_->get_name());
-    event.row_id = row_id;
-    event.new_values = values;
-    fire_change_event(event);
+void ColumnStore::write_row(std::size_t slot, const TableRow& row) {
+    auto& meta = slots_[slot];
+    meta.row_id = row.id_;
+    meta.version = row.version_;
+    meta.created_at = row.created_at_;
+    meta.updated_at = row.updated_at_;
+    meta.in_use = true;
 
-    return row_id;
+    for (auto& column : columns_) {
+        column.set(slot, row.get_value(column.id));
+    }
 }
 
-bool Table::update_row(std::size_t row_id, const std::unordered_map<std::string, CellValue>& values) {
-    std::unique_lock lock(table_mutex_);
+void ColumnStore::insert(const TableRow& row) {
+    auto slot = allocate_slot(row.get_id());
+    write_row(slot, row);
+}
 
-    auto it = rows_.find(row_id);
-    if (it == rows_.end()) {
+bool ColumnStore::update(const TableRow& row) {
+    auto it = row_slots_.find(row.get_id());
+    if (it == row_slots_.end()) {
         return false;
     }
+    write_row(it->second, row);
+    return true;
+}
 
-    auto& row = *it->second;
-    auto old_values = row.get_all_values();
-
-    // Create updated row for validation
-    TableRow updated_row = row;
-    for (const auto& [column, value] : values) {
-        updated_row.set_value(column, value);
+bool ColumnStore::erase(std::size_t row_id) {
+    auto it = row_slots_.find(row_id);
+    if (it == row_slots_.end()) {
+        return false;
     }
 
-    // Validate updated row
-    if (!schema_->validate_row(updated_row)) {
-        auto errors = schema_->get_validation_errors(updated_row);
-        std::string error_msg = "Row validation failed: ";
-        for (const auto& error : errors) {
-            error_msg += error + "; ";
+    auto slot = it->second;
+    slots_[slot].in_use = false;
+
+    // Release variable-width payloads eagerly; fixed-width slots are
+    // simply marked free for reuse.
+    for (auto& column : columns_) {
+        column.nulls[slot] = 1;
+        if (column.type == ColumnType::String || column.type == ColumnType::Json) {
+            column.strings[slot] = std::string{};
+        } else if (column.type == ColumnType::Binary) {
+            column.blobs[slot] = std::vector<std::uint8_t>{};
         }
-        throw std::runtime_error(error_msg);
-    }
-
-    // Update indexes
-    update_indexes_on_update(row, updated_row);
-
-    // Apply changes to actual row
-    for (const auto& [column, value] : values) {
-        row.set_value(column, value);
     }
-    row.increment_version();
-
-    // Update statistics
-    total_updates_++;
-    last_modified_ = std::chrono::system_clock::now();
-
-    // Fire change event
-    ChangeEvent event(ChangeType::RowUpdated, schema_->get_name());
-    event.row_id = row_id;
-    event.old_values = old_values;
-    event.new_values = row.get_all_values();
-    fire_change_event(event);
 
+    free_slots_.push_back(slot);
+    row_slots_.erase(it);
     return true;
 }
 
-bool Table::delete_row(std::size_t row_id) {
-    std::unique_lock lock(table_mutex_);
-
-    auto it = rows_.find(row_id);
-    if (it == rows_.end()) {
-        return false;
-    }
-
-    auto& row = *it->second;
-    auto old_values = row.get_all_values();
-
-    // Update indexes
-    update_indexes_on_delete(row);
-
-    // Remove the row
-    rows_.erase(it);
+bool ColumnStore::contains(std::size_t row_id) const {
+    return row_slots_.find(row_id) != row_slots_.end();
+}
 
-    // Update statistics
-    total_deletes_++;
-    last_modified_ = std::chrono::system_clock::now();
+TableRow ColumnStore::materialize_slot(std::size_t slot) const {
+    const auto& meta = slots_[slot];
+    TableRow row(meta.row_id);
+    row.version_ = meta.version;
+    row.created_at_ = meta.created_at;
+    row.updated_at_ = meta.updated_at;
 
-    // Fire change event
-    ChangeEvent event(ChangeType::RowDeleted, schema_->get_name());
-    event.row_id = row_id;
-    event.old_values = old_values;
-    fire_change_event(event);
+    for (const auto& column : columns_) {
+        if (!column.nulls[slot]) {
+            row.values_[column.id] = column.get(slot);
+        }
+    }
+    return row;
+}
 
-    return true;
+std::optional<TableRow> ColumnStore::materialize(std::size_t row_id) const {
+    auto it = row_slots_.find(row_id);
+    return it != row_slots_.end() ? std::optional<TableRow>(materialize_slot(it->second))
+                                  : std::nullopt;
 }
 
-std::optional<TableRow> Table::get_row(std::size_t row_id) const {
-    std::shared_lock lock(table_mutex_);
+std::vector<TableRow> ColumnStore::materialize(const std::vector<std::size_t>& row_ids) const {
+    std::vector<TableRow> result;
+    result.reserve(row_ids.size());
 
-    auto it = rows_.find(row_id);
-    return it != rows_.end() ? std::optional<TableRow>(*it->second) : std::nullopt;
+    for (auto row_id : row_ids) {
+        auto it = row_slots_.find(row_id);
+        if (it != row_slots_.end()) {
+            result.push_back(materialize_slot(it->second));
+        }
+    }
+    return result;
 }
 
-std::vector<TableRow> Table::get_all_rows() const {
-    std::shared_lock lock(table_mutex_);
-
+std::vector<TableRow> ColumnStore::materialize_all() const {
     std::vector<TableRow> result;
-    result.reserve(rows_.size());
+    result.reserve(row_slots_.size());
 
-    for (const auto& [id, row] : rows_) {
-        result.push_back(*row);
+    for (std::size_t slot = 0; slot < slots_.size(); ++slot) {
+        if (slots_[slot].in_use) {
+            result.push_back(materialize_slot(slot));
+        }
     }
-
     return result;
 }
 
-std::size_t Table::get_row_count() const {
+std::vector<std::size_t> ColumnStore::scan(const std::vector<QueryCondition>& conditions) const {
+    std::vector<std::uint8_t> selection(slots_.size());
+    for (std::size_t slot = 0; slot < slots_.size(); ++slot) {
+        selection[slot] = slots_[slot].in_use ? 1 : 0;
+    }
+
+    for (const auto& condition : conditions) {
+        auto pos = column_positions_.find(condition.column);
+        if (pos == column_positions_.end()) {
+            std::fill(selection.begin(), selection.end(), 0);
+            break;
+        }
+        match_condition(columns_[pos->second], condition, selection);
+    }
+
+    std::vector<std::size_t> result;
+    for (std::size_t slot = 0; slot < selection.size(); ++slot) {
+        if (selection[slot]) {
+            result.push_back(slots_[slot].row_id);
+        }
+    }
+    return result;
+}
+
+void ColumnStore::match_condition(const TypedColumn& column, const QueryCondition& condition,
+                                  std::vector<std::uint8_t>& selection) const {
+    const auto op = condition.op;
+
+    if (op == QueryOperator::IsNull || op == QueryOperator::IsNotNull) {
+        const bool want_null = (op == QueryOperator::IsNull);
+        for (std::size_t slot = 0; slot < selection.size(); ++slot) {
+            if (selection[slot] && (column.nulls[slot] != 0) != want_null) {
+                selection[slot] = 0;
+            }
+        }
+        return;
+    }
+
+    auto compare = [op](auto lhs, auto rhs) {
+        switch (op) {
+            case QueryOperator::Equal: return lhs == rhs;
+            case QueryOperator::NotEqual: return lhs != rhs;
+            case QueryOperator::LessThan: return lhs < rhs;
+            case QueryOperator::LessThanOrEqual: return lhs <= rhs;
+            case QueryOperator::GreaterThan: return lhs > rhs;
+            case QueryOperator::GreaterThanOrEqual: return lhs >= rhs;
+            default: return false;
+        }
+    };
+
+    // Typed fast paths: numeric columns compare against the resolved
+    // target in a tight loop without variant dispatch per cell.
+    switch (column.type) {
+        case ColumnType::Integer:
+            if (const auto* target = std::get_if<std::int64_t>(&condition.value)) {
+                for (std::size_t slot = 0; slot < selection.size(); ++slot) {
+                    if (selection[slot] &&
+                        (column.nulls[slot] || !compare(column.integers[slot], *target))) {
+                        selection[slot] = 0;
+                    }
+                }
+                return;
+            }
+            break;
+        case ColumnType::Double:
+            if (const auto* target = std::get_if<double>(&condition.value)) {
+                for (std::size_t slot = 0; slot < selection.size(); ++slot) {
+                    if (selection[slot] &&
+                        (column.nulls[slot] || !compare(column.doubles[slot], *target))) {
+                        selection[slot] = 0;
+                    }
+                }
+                return;
+            }
+            break;
+        case ColumnType::Boolean:
+            if (const auto* target = std::get_if<bool>(&condition.value)) {
+                for (std::size_t slot = 0; slot < selection.size(); ++slot) {
+                    if (selection[slot] &&
+                        (column.nulls[slot] ||
+                         !compare(static_cast<bool>(column.booleans[slot]), *target))) {
+                        selection[slot] = 0;
+                    }
+                }
+                return;
+            }
+            break;
+        default:
+            break;
+    }
+
+    // Generic fallback for string/datetime/binary columns and operators
+    // like LIKE that need full CellValue semantics
+    for (std::size_t slot = 0; slot < selection.size(); ++slot) {
+        if (selection[slot] &&
+            !cell_utils::compare_values(column.get(slot), condition.value, op)) {
+            selection[slot] = 0;
+        }
+    }
+}
+
+std::size_t ColumnStore::size() const noexcept {
+    return row_slots_.size();
+}
+
+void ColumnStore::clear() {
+    for (auto& column : columns_) {
+        column.integers.clear();
+        column.doubles.clear();
+        column.strings.clear();
+        column.booleans.clear();
+        column.timestamps.clear();
+        column.blobs.clear();
+        column.nulls.clear();
+    }
+    slots_.clear();
+    free_slots_.clear();
+    row_slots_.clear();
+}
+
+// TableTransaction implementation
+TableTransaction::TableTransaction(Table* table, std::string id)
+    : table_(table), id_(std::move(id)) {}
+
+TableTransaction::~TableTransaction() {
+    if (active_ && !committed_ && !rolled_back_) {
+        rollback();
+    }
+}
+
+void TableTransaction::begin() {
+    if (active_) {
+        throw std::runtime_error("Transaction already active");
+    }
+    active_ = true;
+    change_log_.clear();
+    expected_versions_.clear();
+    snapshot_ = table_->snapshot();
+}
+
+void TableTransaction::insert_row(const std::unordered_map<std::string, CellValue>& values) {
+    if (!active_) {
+        throw std::runtime_error("No active transaction");
+    }
+
+    // Validate against the schema now so a bad insert fails at staging
+    // time instead of poisoning the commit
+    TableRow row(0);
+    for (const auto& [column, value] : values) {
+        row.set_value(column, value);
+    }
+    if (!table_->schema_->validate_row(row)) {
+        auto errors = table_->schema_->get_validation_errors(row);
+        std::string error_msg = "Row validation failed: ";
+        for (const auto& error : errors) {
+            error_msg += error + "; ";
+        }
+        throw std::runtime_error(error_msg);
+    }
+
+    ChangeEvent event(ChangeType::RowInserted, table_->schema_->get_name());
+    event.new_values = values;
+    change_log_.push_back(std::move(event));
+}
+
+bool TableTransaction::update_row(std::size_t row_id,
+                                  const std::unordered_map<std::string, CellValue>& values) {
+    if (!active_) {
+        throw std::runtime_error("No active transaction");
+    }
+
+    const TableRow* snapshot_row = snapshot_.get_row(row_id);
+    if (!snapshot_row) {
+        return false;
+    }
+    expected_versions_.try_emplace(row_id, snapshot_row->get_version());
+
+    ChangeEvent event(ChangeType::RowUpdated, table_->schema_->get_name());
+    event.row_id = row_id;
+    event.new_values = values;  // Merged over the live row at commit time
+    change_log_.push_back(std::move(event));
+    return true;
+}
+
+bool TableTransaction::delete_row(std::size_t row_id) {
+    if (!active_) {
+        throw std::runtime_error("No active transaction");
+    }
+
+    const TableRow* snapshot_row = snapshot_.get_row(row_id);
+    if (!snapshot_row) {
+        return false;
+    }
+    expected_versions_.try_emplace(row_id, snapshot_row->get_version());
+
+    ChangeEvent event(ChangeType::RowDeleted, table_->schema_->get_name());
+    event.row_id = row_id;
+    change_log_.push_back(std::move(event));
+    return true;
+}
+
+void TableTransaction::commit() {
+    if (!active_) {
+        throw std::runtime_error("No active transaction");
+    }
+    if (committed_ || rolled_back_) {
+        throw std::runtime_error("Transaction already finalized");
+    }
+
+    {
+        std::unique_lock lock(table_->table_mutex_);
+
+        // First committer wins: every row this transaction touched must
+        // still be at the version the snapshot saw
+        for (const auto& [row_id, expected_version] : expected_versions_) {
+            auto current = table_->get_row_unlocked(row_id);
+            if (!current || current->get_version() != expected_version) {
+                lock.unlock();
+                rolled_back_ = true;
+                active_ = false;
+                change_log_.clear();
+                throw std::runtime_error("Transaction '" + id_ + "' conflicts on row " +
+                                         std::to_string(row_id));
+            }
+        }
+
+        for (auto& event : change_log_) {
+            event.transaction_id = id_;
+            switch (event.type) {
+                case ChangeType::RowInserted:
+                    event.row_id = table_->next_row_id_++;
+                    break;
+                case ChangeType::RowUpdated: {
+                    // Merge the staged columns over the live row so an
+                    // update stages only what it changes
+                    auto current = table_->get_row_unlocked(*event.row_id);
+                    if (!current) {
+                        continue;
+                    }
+                    event.old_values = current->get_all_values();
+                    auto merged = event.old_values;
+                    for (const auto& [column, value] : event.new_values) {
+                        merged[column] = value;
+                    }
+                    event.new_values = std::move(merged);
+                    break;
+                }
+                case ChangeType::RowDeleted: {
+                    if (auto current = table_->get_row_unlocked(*event.row_id)) {
+                        event.old_values = current->get_all_values();
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+            table_->apply_wal_event_unlocked(event);
+            table_->fire_change_event(event);
+        }
+
+        table_->data_version_++;
+        table_->last_modified_ = std::chrono::system_clock::now();
+    }
+
+    committed_ = true;
+    active_ = false;
+    change_log_.clear();
+    expected_versions_.clear();
+}
+
+void TableTransaction::rollback() {
+    if (!active_) {
+        throw std::runtime_error("No active transaction");
+    }
+    if (committed_ || rolled_back_) {
+        throw std::runtime_error("Transaction already finalized");
+    }
+
+    // Staged operations never touched the table; discarding them is the
+    // whole rollback
+    rolled_back_ = true;
+    active_ = false;
+    change_log_.clear();
+    expected_versions_.clear();
+}
+
+// RowPool implementation
+RowPool::RowPool(std::size_t slab_capacity)
+    : slab_capacity_(slab_capacity == 0 ? DEFAULT_SLAB_CAPACITY : slab_capacity) {}
+
+void* RowPool::allocate_slot() {
+    if (free_list_) {
+        FreeNode* node = free_list_;
+        free_list_ = node->next;
+        return node;
+    }
+
+    if (slabs_.empty() || next_slot_ == slab_capacity_) {
+        slabs_.push_back(std::make_unique<std::byte[]>(slab_capacity_ * sizeof(TableRow)));
+        next_slot_ = 0;
+    }
+
+    std::byte* slot = slabs_.back().get() + next_slot_ * sizeof(TableRow);
+    ++next_slot_;
+    return slot;
+}
+
+TableRow* RowPool::construct(std::size_t row_id) {
+    return new (allocate_slot()) TableRow(row_id);
+}
+
+TableRow* RowPool::construct(const TableRow& other) {
+    return new (allocate_slot()) TableRow(other);
+}
+
+void RowPool::destroy(TableRow* row) noexcept {
+    row->~TableRow();
+    auto* node = static_cast<FreeNode*>(static_cast<void*>(row));
+    node->next = free_list_;
+    free_list_ = node;
+}
+
+void RowPool::reclaim() {
+    // Precondition: no live rows remain (the owning table was just cleared)
+    if (slabs_.size() > 1) {
+        slabs_.erase(slabs_.begin() + 1, slabs_.end());
+    }
+    next_slot_ = 0;
+    free_list_ = nullptr;
+}
+
+// Table implementation
+Table::Table(std::unique_ptr<TableSchema> schema, StorageEngine engine)
+    : schema_(std::move(schema))
+    , storage_engine_(engine)
+    , created_at_(std::chrono::system_clock::now())
+    , last_modified_(std::chrono::system_clock::now()) {
+
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        column_store_ = std::make_unique<ColumnStore>(*schema_);
+    }
+
+    // Create primary key index if defined
+    if (!schema_->get_primary_key().empty()) {
+        create_index("__primary_key", schema_->get_primary_key(), true);
+    }
+}
+
+std::size_t Table::insert_row(const std::unordered_map<std::string, CellValue>& values) {
+    // Row-level writes on a RowStore only need the table lock shared; the
+    // row's shard lock provides exclusion, so inserts into different shards
+    // run in parallel. ColumnStore has no per-row storage to stripe, so it
+    // keeps the exclusive table lock.
+    std::shared_lock shared(table_mutex_, std::defer_lock);
+    std::unique_lock exclusive(table_mutex_, std::defer_lock);
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        exclusive.lock();
+    } else {
+        shared.lock();
+    }
+
+    auto row_id = next_row_id_++;
+    TableRow row(row_id);
+
+    // Set all provided values
+    for (const auto& [column, value] : values) {
+        row.set_value(column, value);
+    }
+
+    // Validate row
+    if (!schema_->validate_row(row)) {
+        auto errors = schema_->get_validation_errors(row);
+        std::string error_msg = "Row validation failed: ";
+        for (const auto& error : errors) {
+            error_msg += error + "; ";
+        }
+        throw std::runtime_error(error_msg);
+    }
+
+    // Update indexes (internally synchronized)
+    update_indexes_on_insert(row);
+
+    // Store the row; the shard lock stays held through the change event so
+    // WAL records for the same row keep their mutation order
+    std::unique_lock<std::shared_mutex> shard_lock;
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        column_store_->insert(row);
+    } else {
+        auto& shard = shard_for(row_id);
+        shard_lock = std::unique_lock(shard.mutex);
+        shard.rows[row_id] = make_pooled_row(row);
+    }
+
+    // Update statistics
+    total_inserts_++;
+    static auto& rows_inserted =
+        MetricsRegistry::instance().counter("tables.rows_inserted");
+    rows_inserted.increment();
+    last_modified_ = std::chrono::system_clock::now();
+    data_version_++;
+
+    // Fire change event
+    ChangeEvent event(ChangeType::RowInserted, schema_->get_name());
+    event.row_id = row_id;
+    event.new_values = values;
+    fire_change_event(event);
+
+    return row_id;
+}
+
+std::vector<std::size_t> Table::insert_rows(
+    const std::vector<std::unordered_map<std::string, CellValue>>& rows) {
+    std::vector<std::size_t> row_ids;
+    if (rows.empty()) {
+        return row_ids;
+    }
+
+    std::unique_lock lock(table_mutex_);
+
+    // Build and validate the whole batch before touching storage or indexes
+    // so a bad row rejects the batch without partial effects
+    std::vector<PooledRow> pending;
+    pending.reserve(rows.size());
+    const std::size_t first_row_id = next_row_id_;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        auto row = make_pooled_row(first_row_id + i);
+        for (const auto& [column, value] : rows[i]) {
+            row->set_value(column, value);
+        }
+        if (!schema_->validate_row(*row)) {
+            auto errors = schema_->get_validation_errors(*row);
+            std::string error_msg =
+                "Row validation failed at batch offset " + std::to_string(i) + ": ";
+            for (const auto& error : errors) {
+                error_msg += error + "; ";
+            }
+            throw std::runtime_error(error_msg);
+        }
+        pending.push_back(std::move(row));
+    }
+
+    // Deferred index maintenance: merge the batch one index at a time
+    // instead of walking every index once per row. Unique violations unwind
+    // the entries already merged before rethrowing.
+    auto index_it = indexes_.begin();
+    std::size_t merged_rows = 0;
+    try {
+        for (; index_it != indexes_.end(); ++index_it) {
+            merged_rows = 0;
+            for (const auto& row : pending) {
+                index_it->second->insert(*row);
+                ++merged_rows;
+            }
+        }
+    } catch (...) {
+        for (auto undo_it = indexes_.begin(); undo_it != index_it; ++undo_it) {
+            for (const auto& row : pending) {
+                undo_it->second->remove(*row);
+            }
+        }
+        for (std::size_t i = 0; i < merged_rows; ++i) {
+            index_it->second->remove(*pending[i]);
+        }
+        throw;
+    }
+
+    // Store the batch; WAL recovery still needs one record per row
+    row_ids.reserve(pending.size());
+    for (auto& row : pending) {
+        auto row_id = row->get_id();
+        row_ids.push_back(row_id);
+        if (wal_enabled_) {
+            ChangeEvent record(ChangeType::RowInserted, schema_->get_name());
+            record.row_id = row_id;
+            record.new_values = row->get_all_values();
+            append_wal_record(record);
+        }
+        if (storage_engine_ == StorageEngine::ColumnStore) {
+            column_store_->insert(*row);
+        } else {
+            shard_for(row_id).rows[row_id] = std::move(row);
+        }
+    }
+
+    next_row_id_ = first_row_id + rows.size();
+    total_inserts_ += rows.size();
+    static auto& rows_inserted =
+        MetricsRegistry::instance().counter("tables.rows_inserted");
+    rows_inserted.increment(rows.size());
+    last_modified_ = std::chrono::system_clock::now();
+    data_version_++;
+
+    // One batched notification instead of one callback round per row
+    ChangeEvent event(ChangeType::RowsBulkInserted, schema_->get_name());
+    event.row_id = first_row_id;
+    event.new_values = {{"row_count", static_cast<std::int64_t>(rows.size())}};
+    fire_change_event(event);
+
+    return row_ids;
+}
+
+bool Table::update_row(std::size_t row_id, const std::unordered_map<std::string, CellValue>& values) {
+    std::shared_lock shared(table_mutex_, std::defer_lock);
+    std::unique_lock exclusive(table_mutex_, std::defer_lock);
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        exclusive.lock();
+    } else {
+        shared.lock();
+    }
+
+    TableRow* stored_row = nullptr;
+    std::optional<TableRow> current;
+    std::unique_lock<std::shared_mutex> shard_lock;
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        current = column_store_->materialize(row_id);
+        if (!current) {
+            return false;
+        }
+    } else {
+        auto& shard = shard_for(row_id);
+        shard_lock = std::unique_lock(shard.mutex);
+        auto it = shard.rows.find(row_id);
+        if (it == shard.rows.end()) {
+            return false;
+        }
+        stored_row = it->second.get();
+        current = *stored_row;
+    }
+
+    auto old_values = current->get_all_values();
+
+    // Create updated row for validation
+    TableRow updated_row = *current;
+    for (const auto& [column, value] : values) {
+        updated_row.set_value(column, value);
+    }
+
+    // Validate updated row
+    if (!schema_->validate_row(updated_row)) {
+        auto errors = schema_->get_validation_errors(updated_row);
+        std::string error_msg = "Row validation failed: ";
+        for (const auto& error : errors) {
+            error_msg += error + "; ";
+        }
+        throw std::runtime_error(error_msg);
+    }
+
+    // Update indexes
+    update_indexes_on_update(*current, updated_row);
+
+    // Apply changes to storage
+    updated_row.increment_version();
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        column_store_->update(updated_row);
+    } else {
+        *stored_row = updated_row;
+    }
+
+    // Update statistics
+    total_updates_++;
+    static auto& rows_updated =
+        MetricsRegistry::instance().counter("tables.rows_updated");
+    rows_updated.increment();
+    last_modified_ = std::chrono::system_clock::now();
+    data_version_++;
+
+    // Fire change event
+    ChangeEvent event(ChangeType::RowUpdated, schema_->get_name());
+    event.row_id = row_id;
+    event.old_values = old_values;
+    event.new_values = updated_row.get_all_values();
+    fire_change_event(event);
+
+    return true;
+}
+
+bool Table::delete_row(std::size_t row_id) {
+    std::shared_lock shared(table_mutex_, std::defer_lock);
+    std::unique_lock exclusive(table_mutex_, std::defer_lock);
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        exclusive.lock();
+    } else {
+        shared.lock();
+    }
+
+    std::optional<TableRow> victim;
+    std::unique_lock<std::shared_mutex> shard_lock;
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        victim = column_store_->materialize(row_id);
+        if (!victim) {
+            return false;
+        }
+    } else {
+        auto& shard = shard_for(row_id);
+        shard_lock = std::unique_lock(shard.mutex);
+        auto it = shard.rows.find(row_id);
+        if (it == shard.rows.end()) {
+            return false;
+        }
+        victim = *it->second;
+    }
+
+    auto old_values = victim->get_all_values();
+
+    // Update indexes
+    update_indexes_on_delete(*victim);
+
+    // Remove the row
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        column_store_->erase(row_id);
+    } else {
+        shard_for(row_id).rows.erase(row_id);
+    }
+
+    // Update statistics
+    total_deletes_++;
+    static auto& rows_deleted =
+        MetricsRegistry::instance().counter("tables.rows_deleted");
+    rows_deleted.increment();
+    last_modified_ = std::chrono::system_clock::now();
+    data_version_++;
+
+    // Fire change event
+    ChangeEvent event(ChangeType::RowDeleted, schema_->get_name());
+    event.row_id = row_id;
+    event.old_values = old_values;
+    fire_change_event(event);
+
+    return true;
+}
+
+std::optional<TableRow> Table::get_row(std::size_t row_id) const {
     std::shared_lock lock(table_mutex_);
-    return rows_.size();
+
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        return column_store_->materialize(row_id);
+    }
+
+    const auto& shard = shard_for(row_id);
+    std::shared_lock shard_lock(shard.mutex);
+    auto it = shard.rows.find(row_id);
+    return it != shard.rows.end() ? std::optional<TableRow>(*it->second) : std::nullopt;
 }
 
-std::vector<TableRow> Table::query(const TableQuery& query) const {
+std::vector<TableRow> Table::get_all_rows() const {
+    std::shared_lock lock(table_mutex_);
+    return snapshot_rows_unlocked();
+}
+
+std::size_t Table::get_row_count() const {
     std::shared_lock lock(table_mutex_);
+    return row_count_unlocked();
+}
+
+// TableResultSet implementation
+const TableRow& TableResultSet::at(std::size_t index) const {
+    if (index >= rows_.size()) {
+        throw std::out_of_range("TableResultSet index " + std::to_string(index) +
+                                " out of range (size " + std::to_string(rows_.size()) + ")");
+    }
+    return *rows_[index];
+}
 
+std::vector<TableRow> TableResultSet::materialize() const {
     std::vector<TableRow> result;
     result.reserve(rows_.size());
-
-    // Get all rows first
-    for (const auto& [id, row] : rows_) {
+    for (const auto* row : rows_) {
         result.push_back(*row);
     }
+    return result;
+}
+
+TableSnapshot Table::snapshot() const {
+    // Exclusive lock: row-level writers only hold the table lock shared, so
+    // building a consistent cross-shard copy needs to exclude them. The
+    // cached backing data makes this a pointer copy while the table is
+    // unchanged.
+    std::unique_lock lock(table_mutex_);
+
+    auto version = data_version_.load();
+    {
+        std::lock_guard cache_lock(snapshot_cache_mutex_);
+        if (snapshot_cache_ && snapshot_cache_->version == version) {
+            return TableSnapshot(snapshot_cache_);
+        }
+    }
+
+    auto data = std::make_shared<TableSnapshotData>();
+    data->version = version;
+    data->rows = snapshot_rows_unlocked();
+    data->row_index.reserve(data->rows.size());
+    for (std::size_t i = 0; i < data->rows.size(); ++i) {
+        data->row_index.emplace(data->rows[i].get_id(), i);
+    }
+
+    std::lock_guard cache_lock(snapshot_cache_mutex_);
+    snapshot_cache_ = data;
+    return TableSnapshot(std::move(data));
+}
+
+TableResultSet Table::get_all_rows_view() const {
+    TableResultSet view;
+    view.table_lock_ = std::shared_lock(table_mutex_);
+
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        // No per-row objects to point into; materialize and drop the lock
+        view.owned_rows_ = column_store_->materialize_all();
+        view.rows_.reserve(view.owned_rows_.size());
+        for (const auto& row : view.owned_rows_) {
+            view.rows_.push_back(&row);
+        }
+        view.table_lock_.unlock();
+        return view;
+    }
+
+    // Pin every shard for reading; references stay valid for the view's
+    // lifetime because all writers need one of these locks exclusively
+    view.shard_locks_.reserve(ROW_SHARD_COUNT);
+    for (const auto& shard : shards_) {
+        view.shard_locks_.emplace_back(shard.mutex);
+    }
+    for (const auto& shard : shards_) {
+        for (const auto& [id, row] : shard.rows) {
+            view.rows_.push_back(row.get());
+        }
+    }
+    return view;
+}
+
+TableResultSet Table::query_view(const TableQuery& query) const {
+    TableResultSet view;
+    view.table_lock_ = std::shared_lock(table_mutex_);
+
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        view.owned_rows_ = query_rows_unlocked(query);
+        view.rows_.reserve(view.owned_rows_.size());
+        for (const auto& row : view.owned_rows_) {
+            view.rows_.push_back(&row);
+        }
+        view.table_lock_.unlock();
+        return view;
+    }
+
+    view.shard_locks_.reserve(ROW_SHARD_COUNT);
+    for (const auto& shard : shards_) {
+        view.shard_locks_.emplace_back(shard.mutex);
+    }
+
+    // Gather candidates: an index probe when the planner finds one,
+    // otherwise a full scan over the shards
+    std::vector<const TableRow*> candidates;
+    if (auto planned = plan_index_lookup_unlocked(query)) {
+        candidates.reserve(planned->size());
+        for (auto row_id : *planned) {
+            const auto& shard_rows = shard_for(row_id).rows;
+            if (auto it = shard_rows.find(row_id); it != shard_rows.end()) {
+                candidates.push_back(it->second.get());
+            }
+        }
+    } else {
+        for (const auto& shard : shards_) {
+            for (const auto& [id, row] : shard.rows) {
+                candidates.push_back(row.get());
+            }
+        }
+    }
+
+    // Filter in place; conditions are re-checked even on the index path to
+    // handle residual predicates, mirroring apply_query_filters
+    if (!query.get_conditions().empty()) {
+        std::size_t kept = 0;
+        for (auto* row : candidates) {
+            bool matches = true;
+            for (const auto& condition : query.get_conditions()) {
+                if (!evaluate_condition(*row, condition)) {
+                    matches = false;
+                    break;
+                }
+            }
+            if (matches) {
+                candidates[kept++] = row;
+            }
+        }
+        candidates.erase(candidates.begin() + kept, candidates.end());
+    }
+
+    if (!query.get_order_by().empty()) {
+        std::sort(candidates.begin(), candidates.end(),
+            [&query](const TableRow* a, const TableRow* b) {
+                for (const auto& [column, ascending] : query.get_order_by()) {
+                    auto val_a = a->get_value(column);
+                    auto val_b = b->get_value(column);
+                    if (val_a != val_b) {
+                        bool result = cell_utils::compare_values(val_a, val_b, QueryOperator::LessThan);
+                        return ascending ? result : !result;
+                    }
+                }
+                return false;  // Equal
+            });
+    }
+
+    std::size_t start = std::min(query.get_offset(), candidates.size());
+    std::size_t count = std::min(query.get_limit(), candidates.size() - start);
+    view.rows_.assign(candidates.begin() + start, candidates.begin() + start + count);
+    return view;
+}
+
+std::vector<TableRow> Table::query(const TableQuery& query) const {
+    std::shared_lock lock(table_mutex_);
+    return query_rows_unlocked(query);
+}
+
+std::vector<TableRow> Table::query_rows_unlocked(const TableQuery& query) const {
+    std::vector<TableRow> result;
+    if (auto planned = plan_index_lookup_unlocked(query)) {
+        // Index fast path: candidate row IDs came from an index probe;
+        // apply_query_filters re-checks all conditions for residuals
+        result = materialize_rows_unlocked(*planned);
+    } else if (storage_engine_ == StorageEngine::ColumnStore && !query.get_conditions().empty()) {
+        // Columnar fast path: conditions run as typed loops over the
+        // column vectors and only matching rows are materialized
+        result = column_store_->materialize(column_store_->scan(query.get_conditions()));
+    } else {
+        result = snapshot_rows_unlocked();
+    }
 
     // Apply query filters
     return apply_query_filters(result, query);
 }
 
-std::vector<TableRow> Table::find_by_index(const std::string& index_name,
-                                          const std::vector<CellValue>& key) const {
-    std::shared_lock lock(table_mutex_);
+std::optional<std::vector<std::size_t>> Table::plan_index_lookup_unlocked(
+    const TableQuery& query) const {
+    const auto& conditions = query.get_conditions();
+    if (conditions.empty() || indexes_.empty()) {
+        return std::nullopt;
+    }
 
-    auto index_it = indexes_.find(index_name);
-    if (index_it == indexes_.end()) {
-        throw std::runtime_error("Index '" + index_name + "' not found");
+    // Collect equality predicates by column
+    std::unordered_map<std::string, const QueryCondition*> equality;
+    for (const auto& condition : conditions) {
+        if (condition.op == QueryOperator::Equal) {
+            equality.emplace(condition.column, &condition);
+        }
+    }
+
+    // Prefer an index whose columns are fully covered by equality predicates
+    for (const auto& [name, index] : indexes_) {
+        const auto& columns = index->get_columns();
+        if (columns.empty() || columns.size() > equality.size()) {
+            continue;
+        }
+
+        std::vector<CellValue> key;
+        key.reserve(columns.size());
+        bool covered = true;
+        for (const auto& column : columns) {
+            auto it = equality.find(column);
+            if (it == equality.end()) {
+                covered = false;
+                break;
+            }
+            key.push_back(it->second->value);
+        }
+
+        if (covered) {
+            return index->find_exact(key);
+        }
+    }
+
+    // Otherwise serve bounded range predicates from a single-column ordered
+    // index. find_range is inclusive; strict bounds are re-applied by the
+    // residual filter.
+    struct Bounds {
+        const CellValue* lower = nullptr;
+        const CellValue* upper = nullptr;
+    };
+    std::unordered_map<std::string, Bounds> bounds;
+    for (const auto& condition : conditions) {
+        switch (condition.op) {
+            case QueryOperator::Between:
+                if (condition.value2) {
+                    bounds[condition.column].lower = &condition.value;
+                    bounds[condition.column].upper = &*condition.value2;
+                }
+                break;
+            case QueryOperator::GreaterThan:
+            case QueryOperator::GreaterThanOrEqual:
+                bounds[condition.column].lower = &condition.value;
+                break;
+            case QueryOperator::LessThan:
+            case QueryOperator::LessThanOrEqual:
+                bounds[condition.column].upper = &condition.value;
+                break;
+            default:
+                break;
+        }
+    }
+
+    for (const auto& [column, range] : bounds) {
+        if (!range.lower || !range.upper) {
+            continue;
+        }
+        for (const auto& [name, index] : indexes_) {
+            if (index->get_kind() != IndexKind::Ordered) {
+                continue;
+            }
+            const auto& columns = index->get_columns();
+            if (columns.size() == 1 && columns[0] == column) {
+                return index->find_range({*range.lower}, {*range.upper});
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+std::vector<TableRow> Table::materialize_rows_unlocked(
+    const std::vector<std::size_t>& row_ids) const {
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        return column_store_->materialize(row_ids);
     }
 
-    auto row_ids = index_it->second->find_exact(key);
     std::vector<TableRow> result;
     result.reserve(row_ids.size());
+    for (auto row_id : row_ids) {
+        const auto& shard = shard_for(row_id);
+        std::shared_lock shard_lock(shard.mutex);
+        auto it = shard.rows.find(row_id);
+        if (it != shard.rows.end()) {
+            result.push_back(*it->second);
+        }
+    }
+    return result;
+}
+
+std::vector<TableRow> Table::find_by_index(const std::string& index_name,
+                                          const std::vector<CellValue>& key) const {
+    std::shared_lock lock(table_mutex_);
 
-    for (auto row_id : row_ids) {
-        auto row_it = rows_.find(row_id);
-        if (row_it != rows_.end()) {
-            result.push_back(*row_it->second);
-        }
+    auto index_it = indexes_.find(index_name);
+    if (index_it == indexes_.end()) {
+        throw std::runtime_error("Index '" + index_name + "' not found");
     }
 
-    return result;
+    return materialize_rows_unlocked(index_it->second->find_exact(key));
 }
 
 void Table::evolve_schema(std::unique_ptr<TableSchema> new_schema) {
@@ -685,6 +1791,9 @@ void Table::evolve_schema(std::unique_ptr<TableSchema> new_schema) {
 
     // Apply schema evolution
     schema_ = std::move(new_schema);
+    if (column_store_) {
+        column_store_->rebind_schema(*schema_);
+    }
 
     // Rebuild indexes if necessary
     // This is a simplified approach - in practice, you'd want more sophisticated migration
@@ -695,7 +1804,7 @@ void Table::evolve_schema(std::unique_ptr<TableSchema> new_schema) {
 }
 
 void Table::create_index(const std::string& name, const std::vector<std::string>& columns,
-                        bool unique) {
+                        bool unique, IndexKind kind) {
     std::unique_lock lock(table_mutex_);
 
     if (indexes_.find(name) != indexes_.end()) {
@@ -709,98 +1818,854 @@ void Table::create_index(const std::string& name, const std::vector<std::string>
         }
     }
 
-    auto index = std::make_unique<TableIndex>(name, columns, unique);
+    auto index = std::make_unique<TableIndex>(name, columns, unique, kind);
 
     // Populate index with existing rows
-    for (const auto& [id, row] : rows_) {
-        index->insert(*row);
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        for (const auto& row : column_store_->materialize_all()) {
+            index->insert(row);
+        }
+    } else {
+        for (const auto& shard : shards_) {
+            for (const auto& [id, row] : shard.rows) {
+                index->insert(*row);
+            }
+        }
     }
 
     indexes_[name] = std::move(index);
 
-    // Fire change event
-    ChangeEvent event(ChangeType::IndexCreated, schema_->get_name());
-    fire_change_event(event);
+    // Fire change event
+    ChangeEvent event(ChangeType::IndexCreated, schema_->get_name());
+    fire_change_event(event);
+}
+
+void Table::drop_index(const std::string& name) {
+    std::unique_lock lock(table_mutex_);
+
+    if (name == "__primary_key") {
+        throw std::runtime_error("Cannot drop primary key index");
+    }
+
+    auto it = indexes_.find(name);
+    if (it == indexes_.end()) {
+        throw std::runtime_error("Index '" + name + "' not found");
+    }
+
+    indexes_.erase(it);
+
+    // Fire change event
+    ChangeEvent event(ChangeType::IndexDropped, schema_->get_name());
+    fire_change_event(event);
+}
+
+std::vector<std::string> Table::get_index_names() const {
+    std::shared_lock lock(table_mutex_);
+
+    std::vector<std::string> names;
+    names.reserve(indexes_.size());
+
+    for (const auto& [name, index] : indexes_) {
+        names.push_back(name);
+    }
+
+    return names;
+}
+
+namespace {
+
+// Derive a compact summary from a full change event: the changed column
+// set is the union of keys whose values differ between old and new
+ChangeSummary make_change_summary(const ChangeEvent& event) {
+    ChangeSummary summary;
+    summary.type = event.type;
+    summary.row_id = event.row_id.value_or(0);
+    summary.timestamp = event.timestamp;
+
+    for (const auto& [column, value] : event.new_values) {
+        auto old_it = event.old_values.find(column);
+        if (old_it == event.old_values.end() || old_it->second != value) {
+            summary.changed_columns.push_back(ColumnRegistry::intern(column));
+        }
+    }
+    for (const auto& [column, value] : event.old_values) {
+        if (event.new_values.find(column) == event.new_values.end()) {
+            summary.changed_columns.push_back(ColumnRegistry::intern(column));
+        }
+    }
+    return summary;
+}
+
+}  // namespace
+
+void Table::enable_change_event_queue(std::size_t capacity, ChangeQueueMode mode) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Change event queue capacity must be non-zero");
+    }
+    std::lock_guard queue_lock(change_queue_mutex_);
+    change_queue_enabled_ = true;
+    change_queue_capacity_ = capacity;
+    change_queue_mode_ = mode;
+}
+
+void Table::disable_change_event_queue() {
+    std::lock_guard queue_lock(change_queue_mutex_);
+    change_queue_enabled_ = false;
+    queued_events_.clear();
+    queued_summaries_.clear();
+}
+
+bool Table::is_change_event_queue_enabled() const {
+    std::lock_guard queue_lock(change_queue_mutex_);
+    return change_queue_enabled_;
+}
+
+void Table::add_batch_change_callback(const std::string& name, BatchChangeCallback callback) {
+    std::lock_guard queue_lock(change_queue_mutex_);
+    batch_change_callbacks_[name] = std::move(callback);
+}
+
+void Table::remove_batch_change_callback(const std::string& name) {
+    std::lock_guard queue_lock(change_queue_mutex_);
+    batch_change_callbacks_.erase(name);
+}
+
+void Table::add_change_summary_callback(const std::string& name, ChangeSummaryCallback callback) {
+    std::lock_guard queue_lock(change_queue_mutex_);
+    summary_change_callbacks_[name] = std::move(callback);
+}
+
+void Table::remove_change_summary_callback(const std::string& name) {
+    std::lock_guard queue_lock(change_queue_mutex_);
+    summary_change_callbacks_.erase(name);
+}
+
+std::size_t Table::drain_change_events(std::size_t max_events) {
+    std::vector<ChangeEvent> events;
+    std::vector<ChangeSummary> summaries;
+    std::vector<BatchChangeCallback> batch_subscribers;
+    std::vector<ChangeSummaryCallback> summary_subscribers;
+
+    {
+        std::lock_guard queue_lock(change_queue_mutex_);
+        std::size_t budget = max_events == 0 ? std::numeric_limits<std::size_t>::max()
+                                             : max_events;
+
+        while (budget > 0 && !queued_events_.empty()) {
+            events.push_back(std::move(queued_events_.front()));
+            queued_events_.pop_front();
+            --budget;
+        }
+        while (budget > 0 && !queued_summaries_.empty()) {
+            summaries.push_back(std::move(queued_summaries_.front()));
+            queued_summaries_.pop_front();
+            --budget;
+        }
+
+        for (const auto& [name, callback] : batch_change_callbacks_) {
+            batch_subscribers.push_back(callback);
+        }
+        for (const auto& [name, callback] : summary_change_callbacks_) {
+            summary_subscribers.push_back(callback);
+        }
+    }
+
+    std::size_t delivered = events.size() + summaries.size();
+    if (delivered == 0) {
+        return 0;
+    }
+
+    // In FullEvents mode summary subscribers see summaries derived here,
+    // outside any lock
+    if (!summary_subscribers.empty() && !events.empty()) {
+        summaries.reserve(summaries.size() + events.size());
+        for (const auto& event : events) {
+            summaries.push_back(make_change_summary(event));
+        }
+    }
+
+    if (!events.empty()) {
+        for (const auto& callback : batch_subscribers) {
+            try {
+                callback(events);
+            } catch (const std::exception& e) {
+                Logger::error("Batch change callback failed: {}", e.what());
+            }
+        }
+    }
+    if (!summaries.empty()) {
+        for (const auto& callback : summary_subscribers) {
+            try {
+                callback(summaries);
+            } catch (const std::exception& e) {
+                Logger::error("Change summary callback failed: {}", e.what());
+            }
+        }
+    }
+
+    return delivered;
+}
+
+void Table::add_change_callback(const std::string& name, ChangeCallback callback) {
+    std::unique_lock lock(table_mutex_);
+    change_callbacks_[name] = std::move(callback);
+}
+
+void Table::remove_change_callback(const std::string& name) {
+    std::unique_lock lock(table_mutex_);
+    change_callbacks_.erase(name);
+}
+
+std::unique_ptr<TableTransaction> Table::begin_transaction() {
+    return std::make_unique<TableTransaction>(this, "tx_" + std::to_string(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count()));
+}
+
+bool Table::save_to_file(const std::string& filename) const {
+    try {
+        std::ofstream file(filename);
+        if (!file) {
+            return false;
+        }
+
+        file << to_json();
+        return true;
+    } catch (const std::exception& e) {
+        Logger::error("Failed to save table to file {}: {}", filename, e.what());
+        return false;
+    }
+}
+
+bool Table::load_from_file(const std::string& filename) {
+    try {
+        std::ifstream file(filename);
+        if (!file) {
+            return false;
+        }
+
+        std::string json((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+
+        return from_json(json);
+    } catch (const std::exception& e) {
+        Logger::error("Failed to load table from file {}: {}", filename, e.what());
+        return false;
+    }
+}
+
+// Binary table format
+//
+// Layout (all integers little-endian, host byte order):
+//   magic "BTB1", u32 format version
+//   u32 schema JSON length + bytes (reuses the TableSchema JSON codec)
+//   u8 storage engine, u64 next_row_id/total_inserts/total_updates/total_deletes
+//   i64 created_at/last_modified (milliseconds since epoch)
+//   u32 index count; per index: name, u8 unique, u8 kind, column names
+//   u32 column dictionary count; per entry: column name
+//   u64 row count; per row: u64 id, u32 version, i64 created/updated ms,
+//     u32 cell count; per cell: u32 dictionary slot, u8 type tag, payload
+namespace {
+
+constexpr char BINARY_TABLE_MAGIC[4] = {'B', 'T', 'B', '1'};
+constexpr std::uint32_t BINARY_TABLE_VERSION = 1;
+
+constexpr char WAL_MAGIC[4] = {'B', 'W', 'L', '1'};
+constexpr std::uint32_t WAL_VERSION = 1;
+
+// Cell type tags in the binary format
+enum : std::uint8_t {
+    CELL_TAG_NULL = 0,
+    CELL_TAG_INTEGER = 1,
+    CELL_TAG_DOUBLE = 2,
+    CELL_TAG_STRING = 3,
+    CELL_TAG_BOOLEAN = 4,
+    CELL_TAG_DATETIME = 5,
+    CELL_TAG_BINARY = 6
+};
+
+struct BinaryWriter {
+    std::ofstream& out;
+
+    template <typename T>
+    void write_raw(T value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void write_bytes(const void* data, std::size_t size) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }
+
+    void write_string(const std::string& value) {
+        write_raw(static_cast<std::uint32_t>(value.size()));
+        write_bytes(value.data(), value.size());
+    }
+
+    void write_values(const std::unordered_map<std::string, CellValue>& values) {
+        write_raw(static_cast<std::uint32_t>(values.size()));
+        for (const auto& [name, value] : values) {
+            write_string(name);
+            write_cell(value);
+        }
+    }
+
+    void write_cell(const CellValue& cell) {
+        std::visit([this](const auto& v) {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                write_raw(CELL_TAG_NULL);
+            } else if constexpr (std::is_same_v<T, std::int64_t>) {
+                write_raw(CELL_TAG_INTEGER);
+                write_raw(v);
+            } else if constexpr (std::is_same_v<T, double>) {
+                write_raw(CELL_TAG_DOUBLE);
+                write_raw(v);
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                write_raw(CELL_TAG_STRING);
+                write_string(v);
+            } else if constexpr (std::is_same_v<T, bool>) {
+                write_raw(CELL_TAG_BOOLEAN);
+                write_raw(static_cast<std::uint8_t>(v ? 1 : 0));
+            } else if constexpr (std::is_same_v<T, std::chrono::system_clock::time_point>) {
+                write_raw(CELL_TAG_DATETIME);
+                write_raw(static_cast<std::int64_t>(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        v.time_since_epoch()).count()));
+            } else if constexpr (std::is_same_v<T, std::vector<std::uint8_t>>) {
+                write_raw(CELL_TAG_BINARY);
+                write_raw(static_cast<std::uint32_t>(v.size()));
+                write_bytes(v.data(), v.size());
+            }
+        }, cell);
+    }
+};
+
+// Bounds-checked cursor over a read-only memory mapping
+struct BinaryReader {
+    const std::uint8_t* cursor;
+    const std::uint8_t* end;
+
+    template <typename T>
+    T read_raw() {
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return value;
+    }
+
+    std::string read_string() {
+        auto size = read_raw<std::uint32_t>();
+        require(size);
+        std::string value(reinterpret_cast<const char*>(cursor), size);
+        cursor += size;
+        return value;
+    }
+
+    std::unordered_map<std::string, CellValue> read_values() {
+        std::unordered_map<std::string, CellValue> values;
+        auto count = read_raw<std::uint32_t>();
+        values.reserve(count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            auto name = read_string();
+            values.emplace(std::move(name), read_cell());
+        }
+        return values;
+    }
+
+    CellValue read_cell() {
+        switch (read_raw<std::uint8_t>()) {
+            case CELL_TAG_NULL:
+                return std::monostate{};
+            case CELL_TAG_INTEGER:
+                return read_raw<std::int64_t>();
+            case CELL_TAG_DOUBLE:
+                return read_raw<double>();
+            case CELL_TAG_STRING:
+                return read_string();
+            case CELL_TAG_BOOLEAN:
+                return read_raw<std::uint8_t>() != 0;
+            case CELL_TAG_DATETIME:
+                return std::chrono::system_clock::time_point{
+                    std::chrono::milliseconds{read_raw<std::int64_t>()}};
+            case CELL_TAG_BINARY: {
+                auto size = read_raw<std::uint32_t>();
+                require(size);
+                std::vector<std::uint8_t> blob(cursor, cursor + size);
+                cursor += size;
+                return blob;
+            }
+            default:
+                throw std::runtime_error("Unknown cell type tag in binary table file");
+        }
+    }
+
+    void require(std::size_t bytes) const {
+        if (static_cast<std::size_t>(end - cursor) < bytes) {
+            throw std::runtime_error("Truncated binary table file");
+        }
+    }
+};
+
+// Read-only mapping with RAII unmap
+struct FileMapping {
+    const std::uint8_t* data = nullptr;
+    std::size_t size = 0;
+
+    explicit FileMapping(const std::string& filename) {
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapped = ::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+                                  PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                data = static_cast<const std::uint8_t*>(mapped);
+                size = static_cast<std::size_t>(info.st_size);
+            }
+        }
+        ::close(fd);
+    }
+
+    ~FileMapping() {
+        if (data) {
+            ::munmap(const_cast<std::uint8_t*>(data), size);
+        }
+    }
+
+    FileMapping(const FileMapping&) = delete;
+    FileMapping& operator=(const FileMapping&) = delete;
+};
+
+} // namespace
+
+bool Table::save_to_binary_file(const std::string& filename) const {
+    std::shared_lock lock(table_mutex_);
+    return save_to_binary_file_unlocked(filename);
+}
+
+bool Table::save_to_binary_file_unlocked(const std::string& filename) const {
+    try {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        BinaryWriter writer{file};
+
+        writer.write_bytes(BINARY_TABLE_MAGIC, sizeof(BINARY_TABLE_MAGIC));
+        writer.write_raw(BINARY_TABLE_VERSION);
+        writer.write_string(schema_->to_json());
+
+        writer.write_raw(static_cast<std::uint8_t>(storage_engine_));
+        writer.write_raw(static_cast<std::uint64_t>(next_row_id_.load()));
+        writer.write_raw(static_cast<std::uint64_t>(total_inserts_.load()));
+        writer.write_raw(static_cast<std::uint64_t>(total_updates_.load()));
+        writer.write_raw(static_cast<std::uint64_t>(total_deletes_.load()));
+        writer.write_raw(static_cast<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                created_at_.time_since_epoch()).count()));
+        writer.write_raw(static_cast<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                last_modified_.load().time_since_epoch()).count()));
+
+        writer.write_raw(static_cast<std::uint32_t>(indexes_.size()));
+        for (const auto& [name, index] : indexes_) {
+            writer.write_string(name);
+            writer.write_raw(static_cast<std::uint8_t>(index->is_unique() ? 1 : 0));
+            writer.write_raw(static_cast<std::uint8_t>(
+                index->get_kind() == IndexKind::Hash ? 1 : 0));
+            writer.write_raw(static_cast<std::uint32_t>(index->get_columns().size()));
+            for (const auto& column : index->get_columns()) {
+                writer.write_string(column);
+            }
+        }
+
+        auto rows = snapshot_rows_unlocked();
+
+        // Column dictionary: every ColumnId appearing in any row, written as
+        // names so IDs can be re-interned on load
+        std::unordered_map<ColumnId, std::uint32_t> dictionary_slots;
+        std::vector<ColumnId> dictionary;
+        for (const auto& row : rows) {
+            for (const auto& [id, value] : row.get_all_cells()) {
+                if (dictionary_slots.try_emplace(id, static_cast<std::uint32_t>(dictionary.size())).second) {
+                    dictionary.push_back(id);
+                }
+            }
+        }
+
+        writer.write_raw(static_cast<std::uint32_t>(dictionary.size()));
+        for (auto id : dictionary) {
+            writer.write_string(ColumnRegistry::name_of(id));
+        }
+
+        writer.write_raw(static_cast<std::uint64_t>(rows.size()));
+        for (const auto& row : rows) {
+            writer.write_raw(static_cast<std::uint64_t>(row.get_id()));
+            writer.write_raw(row.get_version());
+            writer.write_raw(static_cast<std::int64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    row.get_created_at().time_since_epoch()).count()));
+            writer.write_raw(static_cast<std::int64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    row.get_updated_at().time_since_epoch()).count()));
+
+            writer.write_raw(static_cast<std::uint32_t>(row.get_all_cells().size()));
+            for (const auto& [id, value] : row.get_all_cells()) {
+                writer.write_raw(dictionary_slots.at(id));
+                writer.write_cell(value);
+            }
+        }
+
+        return file.good();
+    } catch (const std::exception& e) {
+        Logger::error("Failed to save table to binary file {}: {}", filename, e.what());
+        return false;
+    }
+}
+
+bool Table::load_from_binary_file(const std::string& filename) {
+    try {
+        FileMapping mapping(filename);
+        if (!mapping.data) {
+            Logger::error("Failed to map binary table file {}", filename);
+            return false;
+        }
+
+        BinaryReader reader{mapping.data, mapping.data + mapping.size};
+        reader.require(sizeof(BINARY_TABLE_MAGIC));
+        if (std::memcmp(reader.cursor, BINARY_TABLE_MAGIC, sizeof(BINARY_TABLE_MAGIC)) != 0) {
+            Logger::error("File {} is not a binary table file", filename);
+            return false;
+        }
+        reader.cursor += sizeof(BINARY_TABLE_MAGIC);
+
+        auto format_version = reader.read_raw<std::uint32_t>();
+        if (format_version != BINARY_TABLE_VERSION) {
+            Logger::error("Unsupported binary table format version {}", format_version);
+            return false;
+        }
+
+        auto new_schema = std::make_unique<TableSchema>("", 1);
+        if (!new_schema->from_json(reader.read_string())) {
+            return false;
+        }
+
+        std::unique_lock lock(table_mutex_);
+
+        schema_ = std::move(new_schema);
+        storage_engine_ = static_cast<StorageEngine>(reader.read_raw<std::uint8_t>());
+        column_store_ = storage_engine_ == StorageEngine::ColumnStore
+            ? std::make_unique<ColumnStore>(*schema_) : nullptr;
+
+        next_row_id_ = reader.read_raw<std::uint64_t>();
+        total_inserts_ = reader.read_raw<std::uint64_t>();
+        total_updates_ = reader.read_raw<std::uint64_t>();
+        total_deletes_ = reader.read_raw<std::uint64_t>();
+        created_at_ = std::chrono::system_clock::time_point{
+            std::chrono::milliseconds{reader.read_raw<std::int64_t>()}};
+        last_modified_ = std::chrono::system_clock::time_point{
+            std::chrono::milliseconds{reader.read_raw<std::int64_t>()}};
+
+        struct IndexSpec {
+            std::string name;
+            bool unique;
+            IndexKind kind;
+            std::vector<std::string> columns;
+        };
+        std::vector<IndexSpec> index_specs;
+        auto index_count = reader.read_raw<std::uint32_t>();
+        index_specs.reserve(index_count);
+        for (std::uint32_t i = 0; i < index_count; ++i) {
+            IndexSpec spec;
+            spec.name = reader.read_string();
+            spec.unique = reader.read_raw<std::uint8_t>() != 0;
+            spec.kind = reader.read_raw<std::uint8_t>() != 0 ? IndexKind::Hash : IndexKind::Ordered;
+            auto column_count = reader.read_raw<std::uint32_t>();
+            spec.columns.reserve(column_count);
+            for (std::uint32_t c = 0; c < column_count; ++c) {
+                spec.columns.push_back(reader.read_string());
+            }
+            index_specs.push_back(std::move(spec));
+        }
+
+        // Re-intern the column dictionary into this process's IDs
+        auto dictionary_count = reader.read_raw<std::uint32_t>();
+        std::vector<ColumnId> dictionary;
+        dictionary.reserve(dictionary_count);
+        for (std::uint32_t i = 0; i < dictionary_count; ++i) {
+            dictionary.push_back(ColumnRegistry::intern(reader.read_string()));
+        }
+
+        for (auto& shard : shards_) {
+            shard.rows.clear();
+            shard.pool->reclaim();
+        }
+        indexes_.clear();
+
+        auto row_count = reader.read_raw<std::uint64_t>();
+        for (std::uint64_t i = 0; i < row_count; ++i) {
+            auto row = make_pooled_row(static_cast<std::size_t>(reader.read_raw<std::uint64_t>()));
+            row->version_ = reader.read_raw<std::uint32_t>();
+            row->created_at_ = std::chrono::system_clock::time_point{
+                std::chrono::milliseconds{reader.read_raw<std::int64_t>()}};
+            row->updated_at_ = std::chrono::system_clock::time_point{
+                std::chrono::milliseconds{reader.read_raw<std::int64_t>()}};
+
+            auto cell_count = reader.read_raw<std::uint32_t>();
+            for (std::uint32_t c = 0; c < cell_count; ++c) {
+                auto slot = reader.read_raw<std::uint32_t>();
+                if (slot >= dictionary.size()) {
+                    throw std::runtime_error("Invalid column dictionary slot in binary table file");
+                }
+                row->values_[dictionary[slot]] = reader.read_cell();
+            }
+
+            if (storage_engine_ == StorageEngine::ColumnStore) {
+                column_store_->insert(*row);
+            } else {
+                auto row_id = row->get_id();
+                shard_for(row_id).rows[row_id] = std::move(row);
+            }
+        }
+
+        data_version_++;
+
+        // Release lock before calling create_index to avoid deadlock
+        lock.unlock();
+
+        for (const auto& spec : index_specs) {
+            create_index(spec.name, spec.columns, spec.unique, spec.kind);
+        }
+
+        return true;
+    } catch (const std::exception& e) {
+        Logger::error("Failed to load table from binary file {}: {}", filename, e.what());
+        return false;
+    }
 }
 
-void Table::drop_index(const std::string& name) {
+bool Table::enable_wal(const std::string& wal_path) {
     std::unique_lock lock(table_mutex_);
 
-    if (name == "__primary_key") {
-        throw std::runtime_error("Cannot drop primary key index");
+    if (wal_enabled_) {
+        return wal_path_ == wal_path;
     }
 
-    auto it = indexes_.find(name);
-    if (it == indexes_.end()) {
-        throw std::runtime_error("Index '" + name + "' not found");
+    bool fresh_log = true;
+    {
+        std::ifstream existing(wal_path, std::ios::binary);
+        fresh_log = !existing || existing.peek() == std::ifstream::traits_type::eof();
     }
 
-    indexes_.erase(it);
+    wal_stream_.open(wal_path, std::ios::binary | std::ios::app);
+    if (!wal_stream_) {
+        Logger::error("Failed to open WAL file {}", wal_path);
+        return false;
+    }
 
-    // Fire change event
-    ChangeEvent event(ChangeType::IndexDropped, schema_->get_name());
-    fire_change_event(event);
+    if (fresh_log) {
+        BinaryWriter writer{wal_stream_};
+        writer.write_bytes(WAL_MAGIC, sizeof(WAL_MAGIC));
+        writer.write_raw(WAL_VERSION);
+        wal_stream_.flush();
+    }
+
+    wal_path_ = wal_path;
+    wal_enabled_ = true;
+    return true;
 }
 
-std::vector<std::string> Table::get_index_names() const {
-    std::shared_lock lock(table_mutex_);
+void Table::disable_wal() {
+    std::unique_lock lock(table_mutex_);
+    if (wal_enabled_) {
+        wal_stream_.close();
+        wal_enabled_ = false;
+        wal_path_.clear();
+    }
+}
 
-    std::vector<std::string> names;
-    names.reserve(indexes_.size());
+bool Table::is_wal_enabled() const {
+    std::shared_lock lock(table_mutex_);
+    return wal_enabled_;
+}
 
-    for (const auto& [name, index] : indexes_) {
-        names.push_back(name);
+void Table::append_wal_record(const ChangeEvent& event) {
+    // Only row mutations are logged; schema and index changes are carried
+    // by the snapshot written at compaction time
+    if (event.type != ChangeType::RowInserted &&
+        event.type != ChangeType::RowUpdated &&
+        event.type != ChangeType::RowDeleted) {
+        return;
     }
 
-    return names;
+    // Row-level callers hold table_mutex_ only shared, so appends from
+    // different shards serialize here; per-row order is already fixed by
+    // the shard lock held across the mutation and its event
+    std::lock_guard wal_lock(wal_mutex_);
+    BinaryWriter writer{wal_stream_};
+    writer.write_raw(static_cast<std::uint8_t>(event.type));
+    writer.write_raw(static_cast<std::uint64_t>(event.row_id.value_or(0)));
+    writer.write_values(event.old_values);
+    writer.write_values(event.new_values);
+    wal_stream_.flush();
+
+    if (!wal_stream_) {
+        Logger::error("WAL append failed on {}", wal_path_);
+    }
 }
 
-void Table::add_change_callback(const std::string& name, ChangeCallback callback) {
-    std::unique_lock lock(table_mutex_);
-    change_callbacks_[name] = std::move(callback);
+void Table::apply_wal_event_unlocked(const ChangeEvent& event) {
+    if (!event.row_id) {
+        return;
+    }
+    auto row_id = *event.row_id;
+
+    switch (event.type) {
+        case ChangeType::RowInserted: {
+            TableRow row(row_id);
+            for (const auto& [column, value] : event.new_values) {
+                row.set_value(column, value);
+            }
+            update_indexes_on_insert(row);
+            store_row_unlocked(row);
+            next_row_id_ = std::max(next_row_id_.load(), row_id + 1);
+            total_inserts_++;
+            break;
+        }
+        case ChangeType::RowUpdated: {
+            std::optional<TableRow> current;
+            if (storage_engine_ == StorageEngine::ColumnStore) {
+                current = column_store_->materialize(row_id);
+            } else if (auto it = shard_for(row_id).rows.find(row_id);
+                       it != shard_for(row_id).rows.end()) {
+                current = *it->second;
+            }
+            if (!current) {
+                break;
+            }
+
+            TableRow updated(row_id);
+            for (const auto& [column, value] : event.new_values) {
+                updated.set_value(column, value);
+            }
+            // Carry the version chain forward so snapshot conflict checks
+            // see this mutation
+            updated.version_ = current->get_version();
+            updated.increment_version();
+            update_indexes_on_update(*current, updated);
+            if (storage_engine_ == StorageEngine::ColumnStore) {
+                column_store_->update(updated);
+            } else {
+                shard_for(row_id).rows[row_id] = make_pooled_row(updated);
+            }
+            total_updates_++;
+            break;
+        }
+        case ChangeType::RowDeleted: {
+            std::optional<TableRow> current;
+            if (storage_engine_ == StorageEngine::ColumnStore) {
+                current = column_store_->materialize(row_id);
+            } else if (auto it = shard_for(row_id).rows.find(row_id);
+                       it != shard_for(row_id).rows.end()) {
+                current = *it->second;
+            }
+            if (!current) {
+                break;
+            }
+
+            update_indexes_on_delete(*current);
+            if (storage_engine_ == StorageEngine::ColumnStore) {
+                column_store_->erase(row_id);
+            } else {
+                shard_for(row_id).rows.erase(row_id);
+            }
+            total_deletes_++;
+            break;
+        }
+        default:
+            break;
+    }
 }
 
-void Table::remove_change_callback(const std::string& name) {
+bool Table::compact_wal(const std::string& snapshot_path) {
     std::unique_lock lock(table_mutex_);
-    change_callbacks_.erase(name);
-}
 
-std::unique_ptr<TableTransaction> Table::begin_transaction() {
-    return std::make_unique<TableTransaction>(this, "tx_" + std::to_string(
-        std::chrono::duration_cast<std::chrono::microseconds>(
-            std::chrono::system_clock::now().time_since_epoch()).count()));
-}
+    if (!wal_enabled_) {
+        Logger::error("compact_wal called without an enabled WAL");
+        return false;
+    }
 
-bool Table::save_to_file(const std::string& filename) const {
-    try {
-        std::ofstream file(filename);
-        if (!file) {
-            return false;
-        }
+    // Snapshot and truncation happen under one exclusive lock so no
+    // mutation can slip between them
+    if (!save_to_binary_file_unlocked(snapshot_path)) {
+        return false;
+    }
 
-        file << to_json();
-        return true;
-    } catch (const std::exception& e) {
-        Logger::error("Failed to save table to file {}: {}", filename, e.what());
+    wal_stream_.close();
+    wal_stream_.open(wal_path_, std::ios::binary | std::ios::trunc);
+    if (!wal_stream_) {
+        Logger::error("Failed to truncate WAL file {}", wal_path_);
+        wal_enabled_ = false;
         return false;
     }
+
+    BinaryWriter writer{wal_stream_};
+    writer.write_bytes(WAL_MAGIC, sizeof(WAL_MAGIC));
+    writer.write_raw(WAL_VERSION);
+    wal_stream_.flush();
+    return true;
 }
 
-bool Table::load_from_file(const std::string& filename) {
-    try {
-        std::ifstream file(filename);
-        if (!file) {
+bool Table::recover_from_wal(const std::string& snapshot_path, const std::string& wal_path) {
+    // Load the latest snapshot when one exists; a missing snapshot means
+    // the log holds the full history
+    {
+        std::ifstream snapshot(snapshot_path, std::ios::binary);
+        if (snapshot && !load_from_binary_file(snapshot_path)) {
             return false;
         }
+    }
 
-        std::string json((std::istreambuf_iterator<char>(file)),
-                         std::istreambuf_iterator<char>());
+    {
+        FileMapping mapping(wal_path);
+        if (mapping.data) {
+            try {
+                BinaryReader reader{mapping.data, mapping.data + mapping.size};
+                reader.require(sizeof(WAL_MAGIC));
+                if (std::memcmp(reader.cursor, WAL_MAGIC, sizeof(WAL_MAGIC)) != 0) {
+                    Logger::error("File {} is not a WAL file", wal_path);
+                    return false;
+                }
+                reader.cursor += sizeof(WAL_MAGIC);
 
-        return from_json(json);
-    } catch (const std::exception& e) {
-        Logger::error("Failed to load table from file {}: {}", filename, e.what());
-        return false;
+                auto version = reader.read_raw<std::uint32_t>();
+                if (version != WAL_VERSION) {
+                    Logger::error("Unsupported WAL version {}", version);
+                    return false;
+                }
+
+                std::unique_lock lock(table_mutex_);
+                while (reader.cursor < reader.end) {
+                    ChangeEvent event(static_cast<ChangeType>(reader.read_raw<std::uint8_t>()),
+                                      schema_->get_name());
+                    event.row_id = static_cast<std::size_t>(reader.read_raw<std::uint64_t>());
+                    event.old_values = reader.read_values();
+                    event.new_values = reader.read_values();
+                    apply_wal_event_unlocked(event);
+                }
+                data_version_++;
+            } catch (const std::exception& e) {
+                Logger::error("Failed to replay WAL {}: {}", wal_path, e.what());
+                return false;
+            }
+        }
     }
+
+    return enable_wal(wal_path);
 }
 
 std::string Table::to_json() const {
@@ -810,8 +2675,17 @@ std::string Table::to_json() const {
     j["schema"] = nlohmann::json::parse(schema_->to_json());
 
     nlohmann::json rows_json = nlohmann::json::array();
-    for (const auto& [id, row] : rows_) {
-        rows_json.push_back(nlohmann::json::parse(row->to_json()));
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        for (const auto& row : column_store_->materialize_all()) {
+            rows_json.push_back(nlohmann::json::parse(row.to_json()));
+        }
+    } else {
+        for (const auto& shard : shards_) {
+            std::shared_lock shard_lock(shard.mutex);
+            for (const auto& [id, row] : shard.rows) {
+                rows_json.push_back(nlohmann::json::parse(row->to_json()));
+            }
+        }
     }
     j["rows"] = rows_json;
 
@@ -821,6 +2695,7 @@ std::string Table::to_json() const {
         index_json["name"] = name;
         index_json["columns"] = index->get_columns();
         index_json["unique"] = index->is_unique();
+        index_json["kind"] = index->get_kind() == IndexKind::Hash ? "hash" : "ordered";
         indexes_json.push_back(index_json);
     }
     j["indexes"] = indexes_json;
@@ -851,25 +2726,35 @@ bool Table::from_json(const std::string& json) {
             return false;
         }
         schema_ = std::move(new_schema);
+        if (column_store_) {
+            column_store_->rebind_schema(*schema_);
+        }
         Logger::info("Loaded schema: {}", schema_->get_name());
 
         // Load rows
         std::unique_lock lock(table_mutex_);
-        rows_.clear();
+        for (auto& shard : shards_) {
+            shard.rows.clear();
+            shard.pool->reclaim();
+        }
+        if (column_store_) {
+            column_store_->clear();
+        }
         Logger::info("Loading rows...");
 
         for (const auto& row_json : j["rows"]) {
             auto row_str = row_json.dump();
-            auto row = std::make_unique<TableRow>(0);
-            if (row->from_json(row_str)) {
-                auto row_id = row->get_id();
-                rows_[row_id] = std::move(row);
+            TableRow row(0);
+            if (row.from_json(row_str)) {
+                auto row_id = row.get_id();
+                store_row_unlocked(row);
                 next_row_id_ = std::max(next_row_id_.load(), row_id + 1);
             }
         }
 
         // Clear indexes while holding the lock
         indexes_.clear();
+        data_version_++;
 
         // Release lock before calling create_index to avoid deadlock
         lock.unlock();
@@ -881,7 +2766,9 @@ bool Table::from_json(const std::string& json) {
                 create_index(
                     index_json["name"],
                     index_json["columns"],
-                    index_json.value("unique", false)
+                    index_json.value("unique", false),
+                    index_json.value("kind", std::string("ordered")) == "hash"
+                        ? IndexKind::Hash : IndexKind::Ordered
                 );
             }
         }
@@ -915,7 +2802,7 @@ Table::Statistics Table::get_statistics() const {
     std::shared_lock lock(table_mutex_);
 
     return {
-        .row_count = rows_.size(),
+        .row_count = row_count_unlocked(),
         .index_count = indexes_.size(),
         .schema_version = schema_->get_version(),
         .created_at = created_at_,
@@ -927,9 +2814,23 @@ Table::Statistics Table::get_statistics() const {
 }
 
 // TableIterator implementation
-TableIterator::TableIterator(const std::unordered_map<std::size_t, std::unique_ptr<TableRow>>& rows,
-                             std::unordered_map<std::size_t, std::unique_ptr<TableRow>>::const_iterator it)
-    : current_(it), end_(rows.end()) {}
+TableIterator::TableIterator(const RowShardArray& shards, std::size_t shard_index)
+    : shards_(&shards), shard_index_(shard_index) {
+    if (shard_index_ < ROW_SHARD_COUNT) {
+        current_ = (*shards_)[shard_index_].rows.begin();
+        advance_to_populated_shard();
+    }
+}
+
+void TableIterator::advance_to_populated_shard() {
+    while (shard_index_ < ROW_SHARD_COUNT &&
+           current_ == (*shards_)[shard_index_].rows.end()) {
+        ++shard_index_;
+        if (shard_index_ < ROW_SHARD_COUNT) {
+            current_ = (*shards_)[shard_index_].rows.begin();
+        }
+    }
+}
 
 TableIterator::reference TableIterator::operator*() const {
     return *(current_->second);
@@ -941,27 +2842,47 @@ TableIterator::pointer TableIterator::operator->() const {
 
 TableIterator& TableIterator::operator++() {
     ++current_;
+    advance_to_populated_shard();
     return *this;
 }
 
 TableIterator TableIterator::operator++(int) {
     auto temp = *this;
-    ++current_;
+    ++(*this);
     return temp;
 }
 
 bool TableIterator::operator==(const TableIterator& other) const {
-    return current_ == other.current_;
+    if (shard_index_ != other.shard_index_) {
+        return false;
+    }
+    // End iterators compare equal without touching the (singular) inner
+    // iterator
+    return shard_index_ >= ROW_SHARD_COUNT || current_ == other.current_;
 }
 
 bool TableIterator::operator!=(const TableIterator& other) const {
-    return current_ != other.current_;
+    return !(*this == other);
 }
 
 // TableConstIterator implementation
-TableConstIterator::TableConstIterator(const std::unordered_map<std::size_t, std::unique_ptr<TableRow>>& rows,
-                                       std::unordered_map<std::size_t, std::unique_ptr<TableRow>>::const_iterator it)
-    : current_(it), end_(rows.end()) {}
+TableConstIterator::TableConstIterator(const RowShardArray& shards, std::size_t shard_index)
+    : shards_(&shards), shard_index_(shard_index) {
+    if (shard_index_ < ROW_SHARD_COUNT) {
+        current_ = (*shards_)[shard_index_].rows.begin();
+        advance_to_populated_shard();
+    }
+}
+
+void TableConstIterator::advance_to_populated_shard() {
+    while (shard_index_ < ROW_SHARD_COUNT &&
+           current_ == (*shards_)[shard_index_].rows.end()) {
+        ++shard_index_;
+        if (shard_index_ < ROW_SHARD_COUNT) {
+            current_ = (*shards_)[shard_index_].rows.begin();
+        }
+    }
+}
 
 TableConstIterator::reference TableConstIterator::operator*() const {
     return *(current_->second);
@@ -973,26 +2894,31 @@ TableConstIterator::pointer TableConstIterator::operator->() const {
 
 TableConstIterator& TableConstIterator::operator++() {
     ++current_;
+    advance_to_populated_shard();
     return *this;
 }
 
 TableConstIterator TableConstIterator::operator++(int) {
     auto temp = *this;
-    ++current_;
+    ++(*this);
     return temp;
 }
 
 bool TableConstIterator::operator==(const TableConstIterator& other) const {
-    return current_ == other.current_;
+    if (shard_index_ != other.shard_index_) {
+        return false;
+    }
+    return shard_index_ >= ROW_SHARD_COUNT || current_ == other.current_;
 }
 
 bool TableConstIterator::operator!=(const TableConstIterator& other) const {
-    return current_ != other.current_;
+    return !(*this == other);
 }
 
 // Table copy constructor
 Table::Table(const Table& other)
     : schema_(std::make_unique<TableSchema>(*other.schema_))
+    , storage_engine_(other.storage_engine_)
     , created_at_(std::chrono::system_clock::now())
     , last_modified_(std::chrono::system_clock::now())
     , next_row_id_(other.next_row_id_.load())
@@ -1003,9 +2929,16 @@ Table::Table(const Table& other)
 
     std::shared_lock other_lock(other.table_mutex_);
 
-    // Deep copy all rows
-    for (const auto& [id, row_ptr] : other.rows_) {
-        rows_[id] = std::make_unique<TableRow>(*row_ptr);
+    // Deep copy all rows, one shard at a time so concurrent row-level
+    // writers on the source (which hold its table lock shared) are excluded
+    if (other.column_store_) {
+        column_store_ = std::make_unique<ColumnStore>(*other.column_store_);
+    }
+    for (std::size_t s = 0; s < ROW_SHARD_COUNT; ++s) {
+        std::shared_lock shard_lock(other.shards_[s].mutex);
+        for (const auto& [id, row_ptr] : other.shards_[s].rows) {
+            shards_[s].rows[id] = make_pooled_row(*row_ptr);
+        }
     }
 
     // Recreate indexes
@@ -1013,8 +2946,17 @@ Table::Table(const Table& other)
         indexes_[name] = std::make_unique<TableIndex>(*index_ptr);
     }
 
-    // Copy change callbacks (shallow copy of function objects)
+    // Copy change callbacks (shallow copy of function objects); queued
+    // events are transient and stay with the source
     change_callbacks_ = other.change_callbacks_;
+    {
+        std::lock_guard queue_lock(other.change_queue_mutex_);
+        change_queue_enabled_ = other.change_queue_enabled_;
+        change_queue_mode_ = other.change_queue_mode_;
+        change_queue_capacity_ = other.change_queue_capacity_;
+        batch_change_callbacks_ = other.batch_change_callbacks_;
+        summary_change_callbacks_ = other.summary_change_callbacks_;
+    }
 }
 
 // Table copy assignment operator
@@ -1025,12 +2967,18 @@ Table& Table::operator=(const Table& other) {
         std::lock(this_lock, other_lock);
 
         // Clear current state
-        rows_.clear();
+        for (auto& shard : shards_) {
+            shard.rows.clear();
+            shard.pool->reclaim();
+        }
         indexes_.clear();
         change_callbacks_.clear();
 
-        // Copy schema
+        // Copy schema and storage engine
         schema_ = std::make_unique<TableSchema>(*other.schema_);
+        storage_engine_ = other.storage_engine_;
+        column_store_ = other.column_store_
+            ? std::make_unique<ColumnStore>(*other.column_store_) : nullptr;
 
         // Copy metadata
         next_row_id_ = other.next_row_id_.load();
@@ -1039,10 +2987,14 @@ Table& Table::operator=(const Table& other) {
         total_deletes_ = other.total_deletes_.load();
         concurrent_access_enabled_ = other.concurrent_access_enabled_;
         last_modified_ = std::chrono::system_clock::now();
+        data_version_++;
 
-        // Deep copy all rows
-        for (const auto& [id, row_ptr] : other.rows_) {
-            rows_[id] = std::make_unique<TableRow>(*row_ptr);
+        // Deep copy all rows, one shard at a time
+        for (std::size_t s = 0; s < ROW_SHARD_COUNT; ++s) {
+            std::shared_lock shard_lock(other.shards_[s].mutex);
+            for (const auto& [id, row_ptr] : other.shards_[s].rows) {
+                shards_[s].rows[id] = make_pooled_row(*row_ptr);
+            }
         }
 
         // Recreate indexes
@@ -1052,6 +3004,16 @@ Table& Table::operator=(const Table& other) {
 
         // Copy change callbacks
         change_callbacks_ = other.change_callbacks_;
+        {
+            std::scoped_lock queue_locks(change_queue_mutex_, other.change_queue_mutex_);
+            change_queue_enabled_ = other.change_queue_enabled_;
+            change_queue_mode_ = other.change_queue_mode_;
+            change_queue_capacity_ = other.change_queue_capacity_;
+            queued_events_.clear();
+            queued_summaries_.clear();
+            batch_change_callbacks_ = other.batch_change_callbacks_;
+            summary_change_callbacks_ = other.summary_change_callbacks_;
+        }
     }
     return *this;
 }
@@ -1059,7 +3021,8 @@ Table& Table::operator=(const Table& other) {
 // Table move constructor
 Table::Table(Table&& other) noexcept
     : schema_(std::move(other.schema_))
-    , rows_(std::move(other.rows_))
+    , storage_engine_(other.storage_engine_)
+    , column_store_(std::move(other.column_store_))
     , indexes_(std::move(other.indexes_))
     , change_callbacks_(std::move(other.change_callbacks_))
     , created_at_(other.created_at_)
@@ -1070,7 +3033,28 @@ Table::Table(Table&& other) noexcept
     , total_deletes_(other.total_deletes_.load())
     , concurrent_access_enabled_(other.concurrent_access_enabled_) {
 
+    {
+        std::lock_guard queue_lock(other.change_queue_mutex_);
+        change_queue_enabled_ = other.change_queue_enabled_;
+        change_queue_mode_ = other.change_queue_mode_;
+        change_queue_capacity_ = other.change_queue_capacity_;
+        queued_events_ = std::move(other.queued_events_);
+        queued_summaries_ = std::move(other.queued_summaries_);
+        batch_change_callbacks_ = std::move(other.batch_change_callbacks_);
+        summary_change_callbacks_ = std::move(other.summary_change_callbacks_);
+        other.change_queue_enabled_ = false;
+    }
+
+    // Steal each shard's rows and pool; the mutexes stay with their tables
+    for (std::size_t s = 0; s < ROW_SHARD_COUNT; ++s) {
+        shards_[s].rows = std::move(other.shards_[s].rows);
+        shards_[s].pool = std::move(other.shards_[s].pool);
+        other.shards_[s].pool = std::make_unique<RowPool>();
+    }
+
     // Reset the other table to a valid but empty state
+    other.storage_engine_ = StorageEngine::RowStore;
+    other.data_version_++;
     other.next_row_id_ = 1;
     other.total_inserts_ = 0;
     other.total_updates_ = 0;
@@ -1088,9 +3072,28 @@ Table& Table::operator=(Table&& other) noexcept {
 
         // Move all data
         schema_ = std::move(other.schema_);
-        rows_ = std::move(other.rows_);
+        storage_engine_ = other.storage_engine_;
+        for (std::size_t s = 0; s < ROW_SHARD_COUNT; ++s) {
+            // Rows move before the pool so this table's old rows are
+            // released into its old pool
+            shards_[s].rows = std::move(other.shards_[s].rows);
+            shards_[s].pool = std::move(other.shards_[s].pool);
+            other.shards_[s].pool = std::make_unique<RowPool>();
+        }
+        column_store_ = std::move(other.column_store_);
         indexes_ = std::move(other.indexes_);
         change_callbacks_ = std::move(other.change_callbacks_);
+        {
+            std::scoped_lock queue_locks(change_queue_mutex_, other.change_queue_mutex_);
+            change_queue_enabled_ = other.change_queue_enabled_;
+            change_queue_mode_ = other.change_queue_mode_;
+            change_queue_capacity_ = other.change_queue_capacity_;
+            queued_events_ = std::move(other.queued_events_);
+            queued_summaries_ = std::move(other.queued_summaries_);
+            batch_change_callbacks_ = std::move(other.batch_change_callbacks_);
+            summary_change_callbacks_ = std::move(other.summary_change_callbacks_);
+            other.change_queue_enabled_ = false;
+        }
         created_at_ = other.created_at_;
         last_modified_ = other.last_modified_.load();
         next_row_id_ = other.next_row_id_.load();
@@ -1098,8 +3101,11 @@ Table& Table::operator=(Table&& other) noexcept {
         total_updates_ = other.total_updates_.load();
         total_deletes_ = other.total_deletes_.load();
         concurrent_access_enabled_ = other.concurrent_access_enabled_;
+        data_version_++;
 
         // Reset the other table
+        other.storage_engine_ = StorageEngine::RowStore;
+        other.data_version_++;
         other.next_row_id_ = 1;
         other.total_inserts_ = 0;
         other.total_updates_ = 0;
@@ -1112,47 +3118,53 @@ Table& Table::operator=(Table&& other) noexcept {
 
 // Iterator methods
 Table::iterator Table::begin() {
-    return TableIterator(rows_, rows_.begin());
+    return TableIterator(shards_, 0);
 }
 
 Table::iterator Table::end() {
-    return TableIterator(rows_, rows_.end());
+    return TableIterator(shards_, ROW_SHARD_COUNT);
 }
 
 Table::const_iterator Table::begin() const {
-    return TableConstIterator(rows_, rows_.begin());
+    return TableConstIterator(shards_, 0);
 }
 
 Table::const_iterator Table::end() const {
-    return TableConstIterator(rows_, rows_.end());
+    return TableConstIterator(shards_, ROW_SHARD_COUNT);
 }
 
 Table::const_iterator Table::cbegin() const {
-    return TableConstIterator(rows_, rows_.begin());
+    return TableConstIterator(shards_, 0);
 }
 
 Table::const_iterator Table::cend() const {
-    return TableConstIterator(rows_, rows_.end());
+    return TableConstIterator(shards_, ROW_SHARD_COUNT);
 }
 
 // Utility methods
 void Table::clear() {
     std::unique_lock lock(table_mutex_);
 
-    size_t initial_row_count = rows_.size();
+    size_t initial_row_count = row_count_unlocked();
 
     // Fire delete events for all rows
-    if (!change_callbacks_.empty()) {
-        for (const auto& [id, row_ptr] : rows_) {
+    if (!change_callbacks_.empty() || wal_enabled_) {
+        for (const auto& row : snapshot_rows_unlocked()) {
             ChangeEvent event{ChangeType::RowDeleted, schema_->get_name()};
-            event.row_id = id;
-            event.old_values = row_ptr->get_all_values();
+            event.row_id = row.get_id();
+            event.old_values = row.get_all_values();
             fire_change_event(event);
         }
     }
 
-    // Clear all data
-    rows_.clear();
+    // Clear all data and release pooled slabs in bulk
+    for (auto& shard : shards_) {
+        shard.rows.clear();
+        shard.pool->reclaim();
+    }
+    if (column_store_) {
+        column_store_->clear();
+    }
 
     // Clear indexes
     indexes_.clear();
@@ -1160,6 +3172,7 @@ void Table::clear() {
     // Update statistics
     total_deletes_ += initial_row_count;
     last_modified_ = std::chrono::system_clock::now();
+    data_version_++;
 
     // Release lock before recreating primary key index to avoid deadlock
     lock.unlock();
@@ -1172,21 +3185,30 @@ void Table::clear() {
 
 bool Table::empty() const {
     std::shared_lock lock(table_mutex_);
-    return rows_.empty();
+    return row_count_unlocked() == 0;
 }
 
 std::unique_ptr<Table> Table::clone() const {
     std::shared_lock lock(table_mutex_);
 
-    // Create a new table with the same schema
-    auto cloned_table = std::make_unique<Table>(std::make_unique<TableSchema>(*schema_));
+    // Create a new table with the same schema and storage engine
+    auto cloned_table = std::make_unique<Table>(std::make_unique<TableSchema>(*schema_),
+                                               storage_engine_);
 
     // Copy all configuration
     cloned_table->concurrent_access_enabled_ = concurrent_access_enabled_;
 
     // Copy all rows
-    for (const auto& [id, row_ptr] : rows_) {
-        cloned_table->rows_[id] = std::make_unique<TableRow>(*row_ptr);
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        *cloned_table->column_store_ = *column_store_;
+    } else {
+        for (std::size_t sh = 0; sh < ROW_SHARD_COUNT; ++sh) {
+            std::shared_lock shard_lock(shards_[sh].mutex);
+            for (const auto& [id, row_ptr] : shards_[sh].rows) {
+                cloned_table->shards_[sh].rows[id] =
+                    cloned_table->make_pooled_row(*row_ptr);
+            }
+        }
     }
 
     // Recreate indexes with same configuration
@@ -1240,28 +3262,27 @@ void Table::merge_from(const Table& other) {
     // Merge rows (avoiding ID conflicts)
     std::size_t id_offset = next_row_id_.load();
 
-    for (const auto& [other_id, other_row_ptr] : other.rows_) {
-        // Create a new row with adjusted ID
-        auto new_id = id_offset + other_id;
-        auto new_row = std::make_unique<TableRow>(*other_row_ptr);
-        new_row->set_id(new_id);
+    for (auto& new_row : other.snapshot_rows_unlocked()) {
+        // Adjust ID to avoid conflicts
+        auto new_id = id_offset + new_row.get_id();
+        new_row.set_id(new_id);
 
         // Validate the row against this table's schema
-        if (!schema_->validate_row(*new_row)) {
+        if (!schema_->validate_row(new_row)) {
             continue; // Skip invalid rows
         }
 
         // Insert the row
-        rows_[new_id] = std::move(new_row);
+        store_row_unlocked(new_row);
 
         // Update indexes
-        update_indexes_on_insert(*rows_[new_id]);
+        update_indexes_on_insert(new_row);
 
         // Fire change event
         if (!change_callbacks_.empty()) {
             ChangeEvent event{ChangeType::RowInserted, schema_->get_name()};
             event.row_id = new_id;
-            event.new_values = rows_[new_id]->get_all_values();
+            event.new_values = new_row.get_all_values();
             fire_change_event(event);
         }
 
@@ -1271,6 +3292,7 @@ void Table::merge_from(const Table& other) {
     // Update next row ID to avoid future conflicts
     next_row_id_ = id_offset + other.next_row_id_.load();
     last_modified_ = std::chrono::system_clock::now();
+    data_version_++;
 }
 
 void Table::swap(Table& other) noexcept {
@@ -1284,9 +3306,24 @@ void Table::swap(Table& other) noexcept {
 
     // Swap all data members
     std::swap(schema_, other.schema_);
-    std::swap(rows_, other.rows_);
+    std::swap(storage_engine_, other.storage_engine_);
+    for (std::size_t sh = 0; sh < ROW_SHARD_COUNT; ++sh) {
+        std::swap(shards_[sh].rows, other.shards_[sh].rows);
+        std::swap(shards_[sh].pool, other.shards_[sh].pool);
+    }
+    std::swap(column_store_, other.column_store_);
     std::swap(indexes_, other.indexes_);
     std::swap(change_callbacks_, other.change_callbacks_);
+    {
+        std::scoped_lock queue_locks(change_queue_mutex_, other.change_queue_mutex_);
+        std::swap(change_queue_enabled_, other.change_queue_enabled_);
+        std::swap(change_queue_mode_, other.change_queue_mode_);
+        std::swap(change_queue_capacity_, other.change_queue_capacity_);
+        std::swap(queued_events_, other.queued_events_);
+        std::swap(queued_summaries_, other.queued_summaries_);
+        std::swap(batch_change_callbacks_, other.batch_change_callbacks_);
+        std::swap(summary_change_callbacks_, other.summary_change_callbacks_);
+    }
     std::swap(concurrent_access_enabled_, other.concurrent_access_enabled_);
     std::swap(created_at_, other.created_at_);
 
@@ -1308,10 +3345,89 @@ void Table::swap(Table& other) noexcept {
     other.total_updates_ = this_updates;
     other.total_deletes_ = this_deletes;
     other.last_modified_ = this_modified;
+
+    data_version_++;
+    other.data_version_++;
+}
+
+// Storage helpers. Pool access is guarded by the owning shard's lock, so
+// make_pooled_row callers must hold either table_mutex_ exclusively or the
+// lock of the shard the row ID maps to.
+PooledRow Table::make_pooled_row(std::size_t row_id) {
+    auto& pool = *shard_for(row_id).pool;
+    return PooledRow(pool.construct(row_id), RowDeleter{&pool});
+}
+
+PooledRow Table::make_pooled_row(const TableRow& row) {
+    auto& pool = *shard_for(row.get_id()).pool;
+    return PooledRow(pool.construct(row), RowDeleter{&pool});
+}
+
+std::optional<TableRow> Table::get_row_unlocked(std::size_t row_id) const {
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        return column_store_->materialize(row_id);
+    }
+    const auto& shard_rows = shard_for(row_id).rows;
+    auto it = shard_rows.find(row_id);
+    return it != shard_rows.end() ? std::optional<TableRow>(*it->second) : std::nullopt;
+}
+
+void Table::store_row_unlocked(const TableRow& row) {
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        column_store_->insert(row);
+    } else {
+        shard_for(row.get_id()).rows[row.get_id()] = make_pooled_row(row);
+    }
+}
+
+std::vector<TableRow> Table::snapshot_rows_unlocked() const {
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        return column_store_->materialize_all();
+    }
+
+    std::vector<TableRow> result;
+    result.reserve(row_count_unlocked());
+    for (const auto& shard : shards_) {
+        std::shared_lock shard_lock(shard.mutex);
+        for (const auto& [id, row] : shard.rows) {
+            result.push_back(*row);
+        }
+    }
+    return result;
+}
+
+std::size_t Table::row_count_unlocked() const {
+    if (storage_engine_ == StorageEngine::ColumnStore) {
+        return column_store_->size();
+    }
+    std::size_t count = 0;
+    for (const auto& shard : shards_) {
+        std::shared_lock shard_lock(shard.mutex);
+        count += shard.rows.size();
+    }
+    return count;
 }
 
 // Private helper methods
 void Table::fire_change_event(const ChangeEvent& event) {
+    if (wal_enabled_) {
+        append_wal_record(event);
+    }
+
+    {
+        std::lock_guard queue_lock(change_queue_mutex_);
+        if (change_queue_enabled_) {
+            if (queued_events_.size() + queued_summaries_.size() >= change_queue_capacity_) {
+                // Never stall the writer on a slow consumer
+                dropped_change_events_++;
+            } else if (change_queue_mode_ == ChangeQueueMode::SummariesOnly) {
+                queued_summaries_.push_back(make_change_summary(event));
+            } else {
+                queued_events_.push_back(event);
+            }
+        }
+    }
+
     for (const auto& [name, callback] : change_callbacks_) {
         try {
             callback(event);
@@ -1343,46 +3459,170 @@ void Table::update_indexes_on_delete(const TableRow& row) {
     }
 }
 
+namespace {
+
+// Gather the condition column into a contiguous typed block, then run a
+// tight comparison loop over it. Splitting gather and compare keeps the
+// comparison loop free of variant dispatch and amenable to vectorization.
+template <typename T, typename Compare>
+void typed_selection_pass(const std::vector<TableRow>& rows, ColumnId column,
+                          std::vector<std::uint8_t>& selection, Compare compare) {
+    const std::size_t count = rows.size();
+    std::vector<T> block(count, T{});
+    std::vector<std::uint8_t> present(count, 0);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!selection[i]) {
+            continue;
+        }
+        if (const auto* cell = rows[i].find_cell(column)) {
+            if (const auto* value = std::get_if<T>(cell)) {
+                block[i] = *value;
+                present[i] = 1;
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        selection[i] = selection[i] & present[i] & static_cast<std::uint8_t>(compare(block[i]));
+    }
+}
+
+// Returns false when the condition cannot be handled by the typed path
+// (wrong value type or unsupported operator); semantics mirror
+// cell_utils::compare_values, which is type-strict and null-rejecting.
+template <typename T>
+bool typed_condition_dispatch(const std::vector<TableRow>& rows, const QueryCondition& condition,
+                              std::vector<std::uint8_t>& selection) {
+    const T* target_ptr = std::get_if<T>(&condition.value);
+    if (!target_ptr) {
+        return false;
+    }
+    const T target = *target_ptr;
+
+    switch (condition.op) {
+        case QueryOperator::Equal:
+            typed_selection_pass<T>(rows, condition.column_id, selection,
+                                    [target](T v) { return v == target; });
+            return true;
+        case QueryOperator::NotEqual:
+            typed_selection_pass<T>(rows, condition.column_id, selection,
+                                    [target](T v) { return v != target; });
+            return true;
+        case QueryOperator::LessThan:
+            typed_selection_pass<T>(rows, condition.column_id, selection,
+                                    [target](T v) { return v < target; });
+            return true;
+        case QueryOperator::LessThanOrEqual:
+            typed_selection_pass<T>(rows, condition.column_id, selection,
+                                    [target](T v) { return v <= target; });
+            return true;
+        case QueryOperator::GreaterThan:
+            typed_selection_pass<T>(rows, condition.column_id, selection,
+                                    [target](T v) { return v > target; });
+            return true;
+        case QueryOperator::GreaterThanOrEqual:
+            typed_selection_pass<T>(rows, condition.column_id, selection,
+                                    [target](T v) { return v >= target; });
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
 bool Table::evaluate_condition(const TableRow& row, const QueryCondition& condition) const {
-    auto value = row.get_value(condition.column);
+    auto value = condition.column_id != INVALID_COLUMN_ID
+        ? row.get_value(condition.column_id)
+        : row.get_value(condition.column);
     return cell_utils::compare_values(value, condition.value, condition.op);
 }
 
+void Table::evaluate_condition_batch(const std::vector<TableRow>& rows,
+                                     const QueryCondition& condition,
+                                     std::vector<std::uint8_t>& selection) const {
+    if (condition.column_id != INVALID_COLUMN_ID) {
+        if (typed_condition_dispatch<std::int64_t>(rows, condition, selection) ||
+            typed_condition_dispatch<double>(rows, condition, selection) ||
+            typed_condition_dispatch<bool>(rows, condition, selection)) {
+            return;
+        }
+    }
+
+    // Generic fallback: per-row variant comparison for strings, LIKE,
+    // null checks, and anything else the typed passes do not cover
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        if (selection[i] && !evaluate_condition(rows[i], condition)) {
+            selection[i] = 0;
+        }
+    }
+}
+
 std::vector<TableRow> Table::apply_query_filters(const std::vector<TableRow>& rows,
                                                  const TableQuery& query) const {
     std::vector<TableRow> filtered = rows;
 
-    // Apply WHERE conditions
+    // Apply WHERE conditions: each condition narrows a selection bitmap in
+    // one batched pass, then surviving rows are compacted once
     if (!query.get_conditions().empty()) {
-        filtered.erase(
-            std::remove_if(filtered.begin(), filtered.end(),
-                [this, &query](const TableRow& row) {
-                    for (const auto& condition : query.get_conditions()) {
-                        if (!evaluate_condition(row, condition)) {
-                            return true;  // Remove this row
-                        }
-                    }
-                    return false;  // Keep this row
-                }),
-            filtered.end()
-        );
+        std::vector<std::uint8_t> selection(filtered.size(), 1);
+        for (const auto& condition : query.get_conditions()) {
+            evaluate_condition_batch(filtered, condition, selection);
+        }
+
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < filtered.size(); ++i) {
+            if (selection[i]) {
+                if (kept != i) {
+                    filtered[kept] = std::move(filtered[i]);
+                }
+                ++kept;
+            }
+        }
+        filtered.erase(filtered.begin() + kept, filtered.end());
     }
 
     // Apply ORDER BY
     if (!query.get_order_by().empty()) {
-        std::sort(filtered.begin(), filtered.end(),
-            [&query](const TableRow& a, const TableRow& b) {
-                for (const auto& [column, ascending] : query.get_order_by()) {
-                    auto val_a = a.get_value(column);
-                    auto val_b = b.get_value(column);
-
-                    if (val_a != val_b) {
-                        bool result = cell_utils::compare_values(val_a, val_b, QueryOperator::LessThan);
-                        return ascending ? result : !result;
-                    }
+        auto row_less = [&query](const TableRow& a, const TableRow& b) {
+            for (const auto& [column, ascending] : query.get_order_by()) {
+                auto val_a = a.get_value(column);
+                auto val_b = b.get_value(column);
+
+                if (val_a != val_b) {
+                    bool result = cell_utils::compare_values(val_a, val_b, QueryOperator::LessThan);
+                    return ascending ? result : !result;
                 }
-                return false;  // Equal
-            });
+            }
+            return false;  // Equal
+        };
+
+        // With a bounded limit, only the first offset + limit rows in sort
+        // order can appear in the result, so a max-heap of that size replaces
+        // the full O(n log n) sort and its full-size sorted copy
+        std::size_t bound =
+            query.get_limit() <= std::numeric_limits<std::size_t>::max() - query.get_offset()
+                ? query.get_limit() + query.get_offset()
+                : std::numeric_limits<std::size_t>::max();
+        if (bound < filtered.size()) {
+            std::vector<TableRow> top;
+            top.reserve(bound);
+            for (auto& row : filtered) {
+                if (top.size() < bound) {
+                    top.push_back(std::move(row));
+                    std::push_heap(top.begin(), top.end(), row_less);
+                } else if (row_less(row, top.front())) {
+                    std::pop_heap(top.begin(), top.end(), row_less);
+                    top.back() = std::move(row);
+                    std::push_heap(top.begin(), top.end(), row_less);
+                }
+            }
+            std::sort_heap(top.begin(), top.end(), row_less);
+            filtered = std::move(top);
+        } else {
+            std::sort(filtered.begin(), filtered.end(), row_less);
+        }
     }
 
     // Apply OFFSET and LIMIT
@@ -1881,13 +4121,37 @@ std::unique_ptr<TablePager> Table::create_pager(const TableDumpOptions& options)
     return std::make_unique<TablePager>(*this, options);
 }
 
+std::function<bool(std::string&)> Table::create_stream_producer(const TableDumpOptions& options) const {
+    auto effective_options = options;
+    if (effective_options.page_size == 0) {
+        // A single unbounded page would defeat the streaming; fall back to
+        // the default page size
+        effective_options.page_size = TableDumpOptions{}.page_size;
+    }
+
+    // Shared so the returned producer is copyable (std::function requires it)
+    auto pager = std::shared_ptr<TablePager>(create_pager(effective_options));
+    auto next_page = std::make_shared<std::size_t>(0);
+
+    return [pager, next_page](std::string& chunk) -> bool {
+        if (*next_page >= pager->get_total_pages()) {
+            return false;
+        }
+
+        chunk = pager->get_page_as_string(*next_page);
+        chunk += '\n';
+        ++(*next_page);
+        return true;
+    };
+}
+
 void Table::print_summary() const {
     std::shared_lock lock(table_mutex_);
 
     std::cout << "=== Table Summary ===" << std::endl;
     std::cout << "Name: " << schema_->get_name() << std::endl;
     std::cout << "Schema Version: " << schema_->get_version() << std::endl;
-    std::cout << "Rows: " << rows_.size() << std::endl;
+    std::cout << "Rows: " << row_count_unlocked() << std::endl;
     std::cout << "Columns: " << schema_->get_columns().size() << std::endl;
     std::cout << "Indexes: " << indexes_.size() << std::endl;
 
@@ -1955,6 +4219,7 @@ void Table::print_schema() const {
             }
             std::cout << ")";
             if (index->is_unique()) std::cout << " [UNIQUE]";
+            if (index->get_kind() == IndexKind::Hash) std::cout << " [HASH]";
             std::cout << std::endl;
         }
     }
@@ -2005,6 +4270,37 @@ void Table::print_statistics() const {
     }
 }
 
+// TableFactory implementation
+std::unique_ptr<Table> TableFactory::create_table(const std::string& name,
+                                                  const std::vector<ColumnDefinition>& columns,
+                                                  StorageEngine engine) {
+    auto schema = std::make_unique<TableSchema>(name);
+    for (const auto& column : columns) {
+        schema->add_column(column);
+    }
+    return std::make_unique<Table>(std::move(schema), engine);
+}
+
+std::unique_ptr<Table> TableFactory::load_table(const std::string& filename) {
+    auto table = std::make_unique<Table>(std::make_unique<TableSchema>("", 1));
+
+    // Sniff the file magic to pick the format
+    char magic[4] = {};
+    {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file || !file.read(magic, sizeof(magic))) {
+            Logger::error("Failed to open table file {}", filename);
+            return nullptr;
+        }
+    }
+
+    bool loaded = std::memcmp(magic, "BTB1", sizeof(magic)) == 0
+        ? table->load_from_binary_file(filename)
+        : table->load_from_file(filename);
+
+    return loaded ? std::move(table) : nullptr;
+}
+
 // cell_utils namespace implementation
 namespace cell_utils {
 
@@ -0,0 +1,210 @@
+/*
+ * @file timer_wheel.cpp
+ * @brief Hashed timer wheel implementation
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "timer_wheel.h"
+#include "logger.h"
+
+#include <algorithm>
+
+namespace base {
+
+namespace {
+    constexpr std::size_t SLOT_MASK = TimerWheel::SLOT_COUNT - 1;
+    static_assert((TimerWheel::SLOT_COUNT & SLOT_MASK) == 0,
+                  "SLOT_COUNT must be a power of two");
+}
+
+TimerWheel::TimerWheel(asio::io_context& io_context,
+                       std::chrono::milliseconds resolution)
+    : driver_(io_context)
+    , resolution_(resolution)
+    , epoch_(std::chrono::steady_clock::now()) {}
+
+TimerWheel::~TimerWheel() {
+    cancel_all();
+}
+
+TimerWheel::TimerId TimerWheel::schedule_once(std::chrono::milliseconds delay,
+                                              TimerCallback callback) {
+    return schedule_entry(delay, std::chrono::milliseconds{0}, std::move(callback));
+}
+
+TimerWheel::TimerId TimerWheel::schedule_recurring(std::chrono::milliseconds interval,
+                                                   TimerCallback callback) {
+    return schedule_entry(interval, interval, std::move(callback));
+}
+
+TimerWheel::TimerId TimerWheel::schedule_entry(std::chrono::milliseconds delay,
+                                               std::chrono::milliseconds interval,
+                                               TimerCallback callback) {
+    auto entry = std::make_shared<TimerEntry>();
+    entry->callback = std::move(callback);
+    entry->interval = interval;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+        return 0;
+    }
+
+    auto id = next_id_++;
+    if (!driver_armed_) {
+        // The wheel only ticks while the driver is armed, so after an
+        // idle stretch current_tick_ lags wall clock and a deadline
+        // computed against it would be overdue the moment the driver's
+        // catch-up pass runs. An unarmed driver means no pending
+        // entries, so jumping the tick forward skips nothing
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - epoch_);
+        current_tick_ = std::max(
+            current_tick_,
+            static_cast<std::uint64_t>(elapsed.count() / resolution_.count()));
+    }
+    entry->deadline_tick = current_tick_ + ticks_for(delay);
+    insert_unlocked(id, entry->deadline_tick);
+    entries_.emplace(id, std::move(entry));
+
+    if (!driver_armed_) {
+        arm_driver_unlocked();
+    }
+    return id;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        return false;
+    }
+    // The stale ID left in its slot is dropped on the slot's next sweep
+    it->second->cancelled.store(true, std::memory_order_release);
+    entries_.erase(it);
+    return true;
+}
+
+void TimerWheel::cancel_all() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    for (auto& [id, entry] : entries_) {
+        entry->cancelled.store(true, std::memory_order_release);
+    }
+    entries_.clear();
+    for (auto& slot : slots_) {
+        slot.clear();
+    }
+    driver_.cancel();
+}
+
+std::size_t TimerWheel::active_timer_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+std::uint64_t TimerWheel::ticks_for(std::chrono::milliseconds duration) const {
+    if (duration.count() <= 0) {
+        return 1;
+    }
+    auto ticks = static_cast<std::uint64_t>(
+        (duration.count() + resolution_.count() - 1) / resolution_.count());
+    return ticks > 0 ? ticks : 1;
+}
+
+void TimerWheel::insert_unlocked(TimerId id, std::uint64_t deadline_tick) {
+    slots_[deadline_tick & SLOT_MASK].push_back(id);
+}
+
+void TimerWheel::arm_driver_unlocked() {
+    driver_armed_ = true;
+    // Arm against the absolute tick boundary so a busy io_context does
+    // not accumulate drift across ticks
+    driver_.expires_at(epoch_ + (current_tick_ + 1) * resolution_);
+    driver_.async_wait([this](const asio::error_code& ec) {
+        if (!ec) {
+            on_tick();
+        }
+    });
+}
+
+void TimerWheel::on_tick() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_) {
+            driver_armed_ = false;
+            return;
+        }
+
+        // Catch up on every elapsed tick in one pass so a delayed handler
+        // invocation fires overdue timers immediately instead of one per
+        // resolution interval
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - epoch_);
+        auto target_tick = static_cast<std::uint64_t>(
+            elapsed.count() / resolution_.count());
+
+        due_entries_.clear();
+        while (current_tick_ < target_tick) {
+            ++current_tick_;
+            auto& slot = slots_[current_tick_ & SLOT_MASK];
+
+            due_ids_.clear();
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < slot.size(); ++i) {
+                auto it = entries_.find(slot[i]);
+                if (it == entries_.end()) {
+                    continue;  // Cancelled; drop the stale ID
+                }
+                if (it->second->deadline_tick > current_tick_) {
+                    slot[kept++] = slot[i];  // Due on a later wheel round
+                    continue;
+                }
+                due_ids_.push_back(slot[i]);
+            }
+            slot.resize(kept);
+
+            for (auto id : due_ids_) {
+                auto it = entries_.find(id);
+                auto entry = it->second;
+                due_entries_.push_back(entry);
+                if (entry->interval.count() > 0) {
+                    entry->deadline_tick = current_tick_ + ticks_for(entry->interval);
+                    insert_unlocked(id, entry->deadline_tick);
+                } else {
+                    entries_.erase(it);
+                }
+            }
+        }
+
+        // driver_armed_ stays set through the callback phase below so a
+        // concurrent schedule_* cannot arm a second driver invocation
+        // that would race on the scratch buffers
+    }
+
+    // Run callbacks outside the wheel lock so they may schedule or
+    // cancel timers without deadlocking
+    for (auto& entry : due_entries_) {
+        if (entry->cancelled.load(std::memory_order_acquire)) {
+            continue;
+        }
+        try {
+            entry->callback();
+        } catch (const std::exception& e) {
+            Logger::error("Exception in timer wheel callback: {}", e.what());
+        } catch (...) {
+            Logger::error("Unknown exception in timer wheel callback");
+        }
+    }
+
+    // Re-arm only after the callbacks so the driver never runs
+    // concurrently with this invocation
+    std::lock_guard<std::mutex> lock(mutex_);
+    driver_armed_ = false;
+    if (!stopped_ && !entries_.empty()) {
+        arm_driver_unlocked();
+    }
+}
+
+} // namespace base
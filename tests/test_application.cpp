@@ -112,6 +112,37 @@ TEST_F(ApplicationFrameworkTest, ComponentManagement) {
     EXPECT_EQ(non_existent, nullptr);
 }
 
+TEST_F(ApplicationFrameworkTest, ComponentDependencies) {
+    // Components declare dependencies by name; undeclared means wave one
+    class DependentComponent : public TestComponent {
+    public:
+        DependentComponent(std::string name, std::vector<std::string_view> deps)
+            : TestComponent(std::move(name)), deps_(std::move(deps)) {}
+
+        std::vector<std::string_view> dependencies() const override { return deps_; }
+
+    private:
+        std::vector<std::string_view> deps_;
+    };
+
+    ApplicationConfig config;
+    config.worker_threads = 1;
+    config.enable_health_check = false;
+
+    Application app(config);
+    app.add_component(std::make_unique<TestComponent>("storage"));
+    app.add_component(std::make_unique<DependentComponent>(
+        "api", std::vector<std::string_view>{"storage"}));
+
+    auto* storage = app.get_component("storage");
+    auto* api = app.get_component("api");
+    ASSERT_NE(storage, nullptr);
+    ASSERT_NE(api, nullptr);
+    EXPECT_TRUE(storage->dependencies().empty());
+    ASSERT_EQ(api->dependencies().size(), 1u);
+    EXPECT_EQ(api->dependencies().front(), "storage");
+}
+
 TEST_F(ApplicationFrameworkTest, TaskScheduling) {
     ApplicationConfig config;
     config.worker_threads = 1;
@@ -144,6 +175,92 @@ TEST_F(ApplicationFrameworkTest, TaskScheduling) {
     EXPECT_TRUE(true);
 }
 
+TEST_F(ApplicationFrameworkTest, TaskPriorityOrdering) {
+    ApplicationConfig config;
+    config.worker_threads = 1;
+    config.enable_health_check = false;
+
+    Application app(config);
+
+    std::vector<int> order;
+    app.post_task([&order]() { order.push_back(0); }, TaskPriority::Low);
+    app.post_task([&order]() { order.push_back(1); }, TaskPriority::Normal);
+    app.post_task([&order]() { order.push_back(3); }, TaskPriority::Critical);
+    app.post_task([&order]() { order.push_back(2); }, TaskPriority::High);
+
+    // Drain the pending work directly; tasks must come out in lane
+    // order (Critical, High, Normal, Low) regardless of posting order
+    app.io_context().run();
+
+    ASSERT_EQ(order.size(), 4u);
+    EXPECT_EQ(order, (std::vector<int>{3, 2, 1, 0}));
+}
+
+TEST_F(ApplicationFrameworkTest, TaskInstrumentation) {
+    ApplicationConfig config;
+    config.worker_threads = 1;
+    config.enable_health_check = false;
+
+    Application app(config);
+
+    app.post_task([]() {}, TaskPriority::High);
+    app.post_task([]() {});
+
+    auto before = app.task_statistics();
+    EXPECT_EQ(before.queue_depth, 2u);
+    EXPECT_EQ(before.posted[static_cast<std::size_t>(TaskPriority::High)], 1u);
+    EXPECT_EQ(before.posted[static_cast<std::size_t>(TaskPriority::Normal)], 1u);
+
+    app.io_context().run();
+
+    auto after = app.task_statistics();
+    EXPECT_EQ(after.queue_depth, 0u);
+    EXPECT_EQ(after.executed[static_cast<std::size_t>(TaskPriority::High)], 1u);
+    EXPECT_EQ(after.executed[static_cast<std::size_t>(TaskPriority::Normal)], 1u);
+    EXPECT_EQ(after.slow_tasks, 0u);
+
+    std::uint64_t histogram_total = 0;
+    for (auto bucket : after.wait_histogram) {
+        histogram_total += bucket;
+    }
+    EXPECT_EQ(histogram_total, 2u);
+}
+
+TEST_F(ApplicationFrameworkTest, CoroutineTasks) {
+    ApplicationConfig config;
+    config.worker_threads = 1;
+    config.enable_health_check = false;
+
+    Application app(config);
+
+    std::atomic<int> steps{0};
+    app.co_spawn([](std::atomic<int>& steps) -> asio::awaitable<void> {
+        steps++;
+        co_await async_delay(std::chrono::milliseconds(1));
+        steps++;
+    }(steps));
+
+    app.io_context().run();
+    EXPECT_EQ(steps.load(), 2);
+}
+
+TEST_F(ApplicationFrameworkTest, WorkStealingConfigAndFallback) {
+    ApplicationConfig config;
+    config.worker_threads = 2;
+    config.enable_health_check = false;
+    config.enable_work_stealing = true;
+
+    Application app(config);
+    EXPECT_TRUE(app.config().enable_work_stealing);
+
+    // Before the workers start there are no local queues, so posting
+    // falls back to the priority lanes and still executes
+    std::atomic<int> counter{0};
+    app.post_task([&counter]() { counter++; });
+    app.io_context().run();
+    EXPECT_EQ(counter.load(), 1);
+}
+
 TEST_F(ApplicationFrameworkTest, SignalHandling) {
     ApplicationConfig config;
     config.worker_threads = 1;
@@ -196,6 +313,22 @@ TEST_F(ApplicationFrameworkTest, ConfigurationIntegration) {
     EXPECT_EQ(app.config().worker_threads, 2);
 }
 
+TEST_F(ApplicationFrameworkTest, ConfigHotReloadLifecycle) {
+    ApplicationConfig config;
+    config.worker_threads = 1;
+    config.enable_health_check = false;
+
+    Application app(config);
+
+    // Enabling schedules the watcher; enabling twice is a warned no-op
+    app.enable_config_hot_reload(std::chrono::milliseconds(50));
+    app.enable_config_hot_reload(std::chrono::milliseconds(50));
+
+    // Disabling cancels the watcher; disabling twice is harmless
+    app.disable_config_hot_reload();
+    app.disable_config_hot_reload();
+}
+
 TEST_F(ApplicationFrameworkTest, ErrorHandling) {
     ApplicationConfig config;
     config.worker_threads = 1;
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "binary_log.h"
+#include "logger.h"
+
+#include <filesystem>
+#include <sstream>
+#include <string>
+
+using namespace base;
+
+class BinaryLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Logger::init();
+        log_file_ = "test_binary.blog";
+        std::filesystem::remove(log_file_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(log_file_);
+        Logger::shutdown();
+    }
+
+    std::filesystem::path log_file_;
+};
+
+TEST_F(BinaryLogTest, WriteAndDecodeRoundTrip) {
+    {
+        BinaryLogSink sink(log_file_);
+        ASSERT_TRUE(sink.is_open());
+
+        BASE_BINLOG(sink, LogLevel::Info, "request {} served in {}us", 42, 137);
+        BASE_BINLOG(sink, LogLevel::Warn, "queue depth {} above {}", 900, 512);
+        sink.close();
+    }
+
+    std::ostringstream decoded;
+    ASSERT_TRUE(BinaryLogSink::decode_file(log_file_, decoded));
+
+    const auto text = decoded.str();
+    EXPECT_NE(text.find("request 42 served in 137us"), std::string::npos);
+    EXPECT_NE(text.find("queue depth 900 above 512"), std::string::npos);
+    EXPECT_NE(text.find("[INFO]"), std::string::npos);
+    EXPECT_NE(text.find("[WARN]"), std::string::npos);
+}
+
+TEST_F(BinaryLogTest, SupportedFieldTypes) {
+    {
+        BinaryLogSink sink(log_file_);
+        ASSERT_TRUE(sink.is_open());
+
+        std::string name = "sensor-7";
+        BASE_BINLOG(sink, LogLevel::Debug, "{} ok={} count={} ratio={:.2f} tag={}",
+                    name, true, 18446744073709551615ULL, 0.5, "literal");
+        sink.close();
+    }
+
+    std::ostringstream decoded;
+    ASSERT_TRUE(BinaryLogSink::decode_file(log_file_, decoded));
+    EXPECT_NE(decoded.str().find(
+                  "sensor-7 ok=true count=18446744073709551615 ratio=0.50 "
+                  "tag=literal"),
+              std::string::npos);
+}
+
+TEST_F(BinaryLogTest, FormatStringInternedOnce) {
+    constexpr int RECORD_COUNT = 1000;
+    {
+        BinaryLogSink sink(log_file_);
+        ASSERT_TRUE(sink.is_open());
+        for (int i = 0; i < RECORD_COUNT; ++i) {
+            BASE_BINLOG(sink, LogLevel::Info,
+                        "a deliberately long format string that would bloat "
+                        "every record if stored per call: value={}",
+                        i);
+        }
+        sink.close();
+    }
+
+    // One dictionary record plus fixed-size data records: far smaller
+    // than repeating the format text per record
+    const auto file_size = std::filesystem::file_size(log_file_);
+    EXPECT_LT(file_size, RECORD_COUNT * 40u);
+
+    std::ostringstream decoded;
+    ASSERT_TRUE(BinaryLogSink::decode_file(log_file_, decoded));
+    EXPECT_NE(decoded.str().find("value=999"), std::string::npos);
+}
+
+TEST_F(BinaryLogTest, DecodeRejectsForeignFile) {
+    {
+        std::ofstream out(log_file_, std::ios::binary);
+        out << "this is not a binary log";
+    }
+
+    std::ostringstream decoded;
+    EXPECT_FALSE(BinaryLogSink::decode_file(log_file_, decoded));
+}
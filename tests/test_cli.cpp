@@ -21,6 +21,7 @@
 #include "cli.h"
 #include "application.h"
 #include "logger.h"
+#include "metrics.h"
 
 #include <gtest/gtest.h>
 #include <thread>
@@ -237,6 +238,53 @@ TEST_F(CLIUnitTest, ValidCommandExecution) {
     EXPECT_TRUE(result.error_message.empty()) << "Error message should be empty on success";
 }
 
+TEST_F(CLIUnitTest, StreamingResultExecution) {
+    // A streaming command hands back a chunk producer instead of a
+    // materialized output string
+    register_test_command("stream-cmd", "Streaming command", "stream-cmd",
+        [](const CLIContext& context) -> CLIResult {
+            auto remaining = std::make_shared<int>(3);
+            return CLIResult::stream([remaining](std::string& chunk) {
+                if (*remaining == 0) {
+                    return false;
+                }
+                chunk = "chunk-" + std::to_string(3 - *remaining) + "\n";
+                --(*remaining);
+                return true;
+            });
+        }, false);
+
+    auto result = cli_->execute_command("stream-cmd");
+
+    EXPECT_TRUE(result.success) << "Streaming command should succeed";
+    ASSERT_TRUE(result.is_streaming()) << "Result should carry an output producer";
+    EXPECT_TRUE(result.output.empty()) << "Streaming results have no materialized output";
+
+    // Drain the producer the way the transports do: one chunk at a time
+    std::string combined;
+    std::string chunk;
+    while (result.output_producer(chunk)) {
+        combined += chunk;
+        chunk.clear();
+    }
+
+    EXPECT_EQ(combined, "chunk-0\nchunk-1\nchunk-2\n");
+    EXPECT_FALSE(result.output_producer(chunk)) << "Exhausted producer stays exhausted";
+}
+
+TEST_F(CLIUnitTest, NonStreamingResultHasNoProducer) {
+    register_test_command("plain-cmd", "Plain command", "plain-cmd",
+        [](const CLIContext& context) -> CLIResult {
+            return CLIResult::ok("plain output");
+        }, false);
+
+    auto result = cli_->execute_command("plain-cmd");
+
+    EXPECT_TRUE(result.success);
+    EXPECT_FALSE(result.is_streaming()) << "ok() results are fully materialized";
+    EXPECT_EQ(result.output, "plain output");
+}
+
 TEST_F(CLIUnitTest, InvalidCommandExecution) {
     auto result = cli_->execute_command("non-existent-command");
 
@@ -460,6 +508,24 @@ TEST_F(CLIUnitTest, HelpCommand) {
         << "Help should mention commands";
 }
 
+TEST_F(CLIUnitTest, MetricsCommand) {
+    // Touch a metric so the snapshot is non-trivial
+    MetricsRegistry::instance().counter("test.cli_metrics").increment(3);
+
+    auto result = cli_->execute_command("metrics");
+
+    EXPECT_TRUE(result.success) << "Metrics command should succeed";
+    EXPECT_NE(result.output.find("test.cli_metrics"), std::string::npos)
+        << "Snapshot should list registered metrics";
+    EXPECT_NE(result.output.find("counter"), std::string::npos)
+        << "Snapshot should show metric kinds";
+
+    // --reset zeroes the counters after printing
+    result = cli_->execute_command("metrics --reset");
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(MetricsRegistry::instance().counter("test.cli_metrics").value(), 0);
+}
+
 TEST_F(CLIUnitTest, HelpWithSpecificCommand) {
     register_test_command("help-target", "Command for help test", "help-target <arg>",
         [](const CLIContext& context) -> CLIResult {
@@ -403,3 +403,188 @@ TEST_F(ConfigTest, LoggerIntegration) {
     // Test with non-existent app (should use defaults)
     EXPECT_TRUE(config.configure_logger("nonexistent", "default_logger"));
 }
+
+// Typed snapshot binding tests
+namespace {
+
+struct TuningSnapshot {
+    int batch_size = 0;
+    double target_ratio = 0.0;
+    std::string mode;
+
+    static TuningSnapshot from_config(const ConfigManager& manager,
+                                      std::string_view app_name) {
+        TuningSnapshot snapshot;
+        snapshot.batch_size =
+            manager.get_value_or<int>("tuning.batch_size", 64, app_name);
+        snapshot.target_ratio =
+            manager.get_value_or<double>("tuning.target_ratio", 0.5, app_name);
+        snapshot.mode = manager.get_value_or<std::string>("tuning.mode",
+                                                          "balanced", app_name);
+        return snapshot;
+    }
+};
+
+} // namespace
+
+TEST_F(ConfigTest, TypedSnapshotBinding) {
+    auto& config = ConfigManager::instance();
+    ASSERT_TRUE(config.load_from_string(R"(
+[myapp.tuning]
+batch_size = 128
+target_ratio = 0.75
+mode = "throughput"
+)", "myapp"));
+
+    auto binding = config.bind<TuningSnapshot>("myapp");
+    auto snapshot = binding.snapshot();
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_EQ(snapshot->batch_size, 128);
+    EXPECT_DOUBLE_EQ(snapshot->target_ratio, 0.75);
+    EXPECT_EQ(snapshot->mode, "throughput");
+}
+
+TEST_F(ConfigTest, TypedSnapshotRefreshesOnReload) {
+    auto& config = ConfigManager::instance();
+    ASSERT_TRUE(config.load_from_string(R"(
+[myapp.tuning]
+batch_size = 128
+)", "myapp"));
+
+    auto binding = config.bind<TuningSnapshot>("myapp");
+    auto before = binding.snapshot();
+    EXPECT_EQ(before->batch_size, 128);
+
+    // A new load publishes a fresh snapshot...
+    ASSERT_TRUE(config.load_from_string(R"(
+[myapp.tuning]
+batch_size = 256
+)", "myapp"));
+
+    auto after = binding.snapshot();
+    EXPECT_EQ(after->batch_size, 256);
+
+    // ...while snapshots already held stay immutable
+    EXPECT_EQ(before->batch_size, 128);
+}
+
+TEST_F(ConfigTest, TypedSnapshotDefaultsWithoutConfig) {
+    auto& config = ConfigManager::instance();
+
+    auto binding = config.bind<TuningSnapshot>("missing_app");
+    auto snapshot = binding.snapshot();
+    EXPECT_EQ(snapshot->batch_size, 64);
+    EXPECT_DOUBLE_EQ(snapshot->target_ratio, 0.5);
+    EXPECT_EQ(snapshot->mode, "balanced");
+}
+
+// Incremental change notification tests
+namespace {
+
+bool has_change(const std::vector<ConfigChange>& changes, std::string_view key,
+                ConfigChange::Type type) {
+    for (const auto& change : changes) {
+        if (change.key == key && change.type == type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_F(ConfigTest, FirstLoadEmitsNoChangeNotifications) {
+    auto& config = ConfigManager::instance();
+
+    std::vector<ConfigChange> changes;
+    auto id = config.subscribe_changes(
+        [&changes](const ConfigChange& change) { changes.push_back(change); });
+
+    // There is no previous tree to diff against on the first load
+    ASSERT_TRUE(config.load_from_string(sample_config_content(), "myapp"));
+    EXPECT_TRUE(changes.empty());
+
+    config.unsubscribe_changes(id);
+}
+
+TEST_F(ConfigTest, ChangeNotificationsOnReload) {
+    auto& config = ConfigManager::instance();
+    ASSERT_TRUE(config.load_from_string(R"(
+[myapp.tuning]
+batch_size = 128
+mode = "throughput"
+
+[myapp.cache]
+ttl_seconds = 3600
+
+[myapp.schedule]
+maintenance_at = 2026-01-01T03:00:00
+anniversary = 2025-06-15
+)", "myapp"));
+
+    std::vector<ConfigChange> changes;
+    auto id = config.subscribe_changes(
+        [&changes](const ConfigChange& change) { changes.push_back(change); });
+
+    // batch_size and maintenance_at modified, cache.ttl_seconds removed,
+    // logging.level added, mode and anniversary untouched
+    ASSERT_TRUE(config.load_from_string(R"(
+[myapp.tuning]
+batch_size = 256
+mode = "throughput"
+
+[myapp.logging]
+level = "debug"
+
+[myapp.schedule]
+maintenance_at = 2026-02-01T03:00:00
+anniversary = 2025-06-15
+)", "myapp"));
+
+    EXPECT_TRUE(has_change(changes, "tuning.batch_size", ConfigChange::Type::Modified));
+    EXPECT_TRUE(has_change(changes, "cache.ttl_seconds", ConfigChange::Type::Removed));
+    EXPECT_TRUE(has_change(changes, "logging.level", ConfigChange::Type::Added));
+    EXPECT_TRUE(has_change(changes, "schedule.maintenance_at",
+                           ConfigChange::Type::Modified));
+    EXPECT_FALSE(has_change(changes, "tuning.mode", ConfigChange::Type::Modified));
+    EXPECT_FALSE(has_change(changes, "schedule.anniversary",
+                            ConfigChange::Type::Modified));
+    for (const auto& change : changes) {
+        EXPECT_EQ(change.app_name, "myapp");
+    }
+
+    config.unsubscribe_changes(id);
+}
+
+TEST_F(ConfigTest, UnsubscribedHandlerReceivesNothing) {
+    auto& config = ConfigManager::instance();
+    ASSERT_TRUE(config.load_from_string("[myapp.tuning]\nbatch_size = 1\n", "myapp"));
+
+    int calls = 0;
+    auto id = config.subscribe_changes([&calls](const ConfigChange&) { ++calls; });
+    config.unsubscribe_changes(id);
+
+    ASSERT_TRUE(config.load_from_string("[myapp.tuning]\nbatch_size = 2\n", "myapp"));
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(ConfigTest, PollFileChangesDetectsModification) {
+    auto& config = ConfigManager::instance();
+
+    // Nothing loaded from a file yet
+    EXPECT_FALSE(config.poll_file_changes());
+
+    std::ofstream("test_config.toml") << sample_config_content();
+    ASSERT_TRUE(config.load_config("test_config.toml", "myapp"));
+
+    // File untouched since the load
+    EXPECT_FALSE(config.poll_file_changes());
+
+    // Bump the modification time without waiting for filesystem granularity
+    std::filesystem::last_write_time(
+        "test_config.toml",
+        std::filesystem::last_write_time("test_config.toml") + std::chrono::seconds(2));
+
+    EXPECT_TRUE(config.poll_file_changes());
+    EXPECT_FALSE(config.poll_file_changes());
+}
@@ -124,6 +124,66 @@ TEST_F(LoggerTest, FileLoggingConfiguration) {
     EXPECT_NE(content.find("File log test message"), std::string::npos);
 }
 
+TEST_F(LoggerTest, AsyncLoggingConfiguration) {
+    base::Logger::shutdown();
+    EXPECT_FALSE(base::Logger::is_async());
+
+    base::LoggerConfig config{
+        .app_name = "async_test",
+        .log_file = test_log_file_,
+        .enable_console = false,
+        .enable_file = true,
+        .enable_async = true,
+        .async_queue_size = 1024
+    };
+    base::Logger::init(config);
+
+    EXPECT_TRUE(base::Logger::is_initialized());
+    EXPECT_TRUE(base::Logger::is_async());
+
+    for (int i = 0; i < 200; ++i) {
+        base::Logger::info("Async message {}", i);
+    }
+    base::Logger::flush();
+
+    // Block policy never loses messages
+    EXPECT_EQ(base::Logger::async_overrun_count(), 0u);
+
+    // Shutdown drains the ring and joins the worker thread
+    base::Logger::shutdown();
+    EXPECT_FALSE(base::Logger::is_async());
+
+    std::ifstream log_file(test_log_file_);
+    std::string content((std::istreambuf_iterator<char>(log_file)),
+                        std::istreambuf_iterator<char>());
+    EXPECT_NE(content.find("Async message 199"), std::string::npos);
+}
+
+TEST_F(LoggerTest, AsyncDropOldestOverflowPolicy) {
+    base::Logger::shutdown();
+
+    base::LoggerConfig config{
+        .app_name = "async_drop_test",
+        .log_file = test_log_file_,
+        .enable_console = false,
+        .enable_file = true,
+        .enable_async = true,
+        .async_queue_size = 4,
+        .async_overflow_policy = base::AsyncOverflowPolicy::DropOldest
+    };
+    base::Logger::init(config);
+
+    // Must never block, even when the burst outruns the tiny ring
+    for (int i = 0; i < 1000; ++i) {
+        base::Logger::info("Burst message {}", i);
+    }
+    base::Logger::flush();
+
+    // Drops (if any, depending on drain speed) are counted, not silent
+    auto dropped = base::Logger::async_overrun_count();
+    EXPECT_LE(dropped, 1000u);
+}
+
 // ======================================
 // LOG LEVEL MANAGEMENT TESTS
 // ======================================
@@ -244,6 +304,144 @@ TEST_F(LoggerTest, ComponentMacros) {
     db.warn("Database warning via macro");
 }
 
+TEST_F(LoggerTest, CompileTimeLevelGate) {
+    // Default gate compiles every level in
+    static_assert(BASE_LOG_ACTIVE_LEVEL == BASE_LOG_LEVEL_TRACE);
+    static_assert(base::Logger::level_compiled_in(base::LogLevel::Trace));
+    static_assert(base::Logger::level_compiled_in(base::LogLevel::Critical));
+
+    // Component tags are constexpr
+    constexpr auto tag = base::Logger::component("Network");
+    static_assert(tag.name == "Network");
+
+    int evaluations = 0;
+    BASE_LOG_INFO("gated info {}", ++evaluations);
+    BASE_LOG_DEBUG("gated debug {}", ++evaluations);
+    EXPECT_EQ(evaluations, 2);
+}
+
+TEST_F(LoggerTest, MacrosSkipArgumentsForDisabledComponents) {
+    base::Logger::disable_components({"Filtered"});
+
+    int evaluations = 0;
+    auto expensive = [&evaluations]() {
+        ++evaluations;
+        return 42;
+    };
+
+    // Disabled component: the filter check short-circuits before the
+    // format arguments are evaluated
+    LOGGER_INFO("Filtered", "value {}", expensive());
+    EXPECT_EQ(evaluations, 0);
+
+    LOGGER_INFO("Allowed", "value {}", expensive());
+    EXPECT_EQ(evaluations, 1);
+
+    base::Logger::clear_component_filters();
+}
+
+// ======================================
+// RATE LIMITING TESTS
+// ======================================
+
+namespace {
+
+// Counts how many times a format string appears in the log file
+std::size_t count_occurrences(const std::string& path, const std::string& needle) {
+    std::ifstream file(path);
+    std::string content((std::istreambuf_iterator<char>(file)),
+                        std::istreambuf_iterator<char>());
+    std::size_t count = 0;
+    for (auto pos = content.find(needle); pos != std::string::npos;
+         pos = content.find(needle, pos + needle.size())) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+TEST_F(LoggerTest, LogEveryNEmitsAndSummarizes) {
+    base::Logger::shutdown();
+    base::LoggerConfig config{
+        .log_file = test_log_file_,
+        .enable_console = false,
+        .enable_file = true
+    };
+    base::Logger::init(config);
+
+    int evaluations = 0;
+    for (int i = 0; i < 25; ++i) {
+        BASE_LOG_EVERY_N(info, 10, "every-n tick {}", (++evaluations, i));
+    }
+    base::Logger::flush();
+
+    // Calls 0, 10 and 20 emit; suppressed calls never evaluate arguments
+    EXPECT_EQ(count_occurrences(test_log_file_, "every-n tick"), 3u);
+    EXPECT_EQ(evaluations, 3);
+    EXPECT_EQ(count_occurrences(test_log_file_, "suppressed 9 duplicates"), 2u);
+}
+
+TEST_F(LoggerTest, LogFirstNStopsAfterQuota) {
+    base::Logger::shutdown();
+    base::LoggerConfig config{
+        .log_file = test_log_file_,
+        .enable_console = false,
+        .enable_file = true
+    };
+    base::Logger::init(config);
+
+    for (int i = 0; i < 50; ++i) {
+        BASE_LOG_FIRST_N(warn, 3, "first-n warning {}", i);
+    }
+    base::Logger::flush();
+
+    EXPECT_EQ(count_occurrences(test_log_file_, "first-n warning"), 3u);
+}
+
+TEST_F(LoggerTest, LogRateLimitedSuppressesBursts) {
+    base::Logger::shutdown();
+    base::LoggerConfig config{
+        .log_file = test_log_file_,
+        .enable_console = false,
+        .enable_file = true
+    };
+    base::Logger::init(config);
+
+    // One call site: the burst is suppressed, then the call after the
+    // window expires emits again along with the summary
+    for (int i = 0; i <= 100; ++i) {
+        BASE_LOG_RATE_LIMITED(error, 100, "dependency down {}", i);
+        if (i == 99) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(150));
+        }
+    }
+    base::Logger::flush();
+
+    EXPECT_EQ(count_occurrences(test_log_file_, "dependency down"), 2u);
+    EXPECT_EQ(count_occurrences(test_log_file_, "suppressed 99 duplicates"), 1u);
+}
+
+TEST_F(LoggerTest, ComponentLoggerRateLimiting) {
+    base::Logger::shutdown();
+    base::LoggerConfig config{
+        .log_file = test_log_file_,
+        .enable_console = false,
+        .enable_file = true
+    };
+    base::Logger::init(config);
+
+    COMPONENT_LOGGER(network);
+    for (int i = 0; i < 20; ++i) {
+        COMPONENT_LOG_EVERY_N(network, warn, 10, "retry {} failed", i);
+        COMPONENT_LOG_FIRST_N(network, info, 2, "startup step {}", i);
+    }
+    base::Logger::flush();
+
+    EXPECT_EQ(count_occurrences(test_log_file_, "retry"), 2u);
+    EXPECT_EQ(count_occurrences(test_log_file_, "startup step"), 2u);
+}
+
 // ======================================
 // THREAD SAFETY TESTS
 // ======================================
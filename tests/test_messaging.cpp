@@ -166,6 +166,31 @@ TEST_F(MessagingTest, MessagePriority) {
     context->stop();
 }
 
+TEST_F(MessagingTest, MessagePriorityLaneOrdering) {
+    asio::io_context io_context;
+    auto context = std::make_shared<ThreadMessagingContext>("lane_thread", io_context);
+
+    std::vector<int> received_order;
+    context->subscribe<SimpleMessage>([&received_order](const SimpleMessage& msg) {
+        received_order.push_back(msg.value);
+    });
+    context->start();
+
+    // Queue before the consumer runs; delivery must drain lanes
+    // highest-first regardless of send order
+    context->send_message(SimpleMessage{0, "low"}, MessagePriority::Low);
+    context->send_message(SimpleMessage{1, "normal"}, MessagePriority::Normal);
+    context->send_message(SimpleMessage{3, "critical"}, MessagePriority::Critical);
+    context->send_message(SimpleMessage{2, "high"}, MessagePriority::High);
+
+    io_context.run();
+
+    ASSERT_EQ(received_order.size(), 4u);
+    EXPECT_EQ(received_order, (std::vector<int>{3, 2, 1, 0}));
+
+    context->stop();
+}
+
 TEST_F(MessagingTest, MultipleMessageTypes) {
     asio::io_context io_context;
     auto context = std::make_shared<ThreadMessagingContext>("test_thread", io_context);
@@ -241,6 +266,176 @@ TEST_F(MessagingTest, UnsubscribeFromMessages) {
     context->stop();
 }
 
+TEST_F(MessagingTest, TypedChannelDispatch) {
+    asio::io_context io_context;
+    auto context = std::make_shared<ThreadMessagingContext>("channel_thread", io_context);
+
+    std::atomic<int> received_total{0};
+    auto channel = context->open_channel<SimpleMessage>(
+        [&received_total](const SimpleMessage& msg) {
+            received_total += msg.value;
+        });
+
+    EXPECT_TRUE(channel->is_open());
+    EXPECT_TRUE(channel->send(SimpleMessage{1, "one"}));
+    EXPECT_TRUE(channel->send(SimpleMessage{2, "two"}));
+
+    io_context.restart();
+    io_context.run();
+    EXPECT_EQ(received_total.load(), 3);
+
+    // Closed channels refuse new messages
+    channel->close();
+    EXPECT_FALSE(channel->is_open());
+    EXPECT_FALSE(channel->send(SimpleMessage{4, "late"}));
+
+    io_context.restart();
+    io_context.run();
+    EXPECT_EQ(received_total.load(), 3);
+}
+
+TEST_F(MessagingTest, BatchedChannelDelivery) {
+    asio::io_context io_context;
+    auto context = std::make_shared<ThreadMessagingContext>("batched_thread", io_context);
+
+    std::atomic<int> received{0};
+    auto channel = context->open_batched_channel<SimpleMessage>(
+        [&received](const SimpleMessage&) { received++; },
+        256);
+
+    EXPECT_EQ(channel->capacity(), 256u);
+
+    // A burst enqueues without per-message posts; depth is visible for
+    // backpressure before the consumer drains
+    constexpr int burst = 200;
+    for (int i = 0; i < burst; ++i) {
+        EXPECT_TRUE(channel->try_send(SimpleMessage{i, "burst"}));
+    }
+    EXPECT_EQ(context->pending_message_count(), static_cast<std::size_t>(burst));
+
+    io_context.restart();
+    io_context.run();
+    EXPECT_EQ(received.load(), burst);
+    EXPECT_EQ(context->pending_message_count(), 0u);
+}
+
+TEST_F(MessagingTest, BatchedChannelBackpressure) {
+    asio::io_context io_context;
+    auto context = std::make_shared<ThreadMessagingContext>("bp_thread", io_context);
+
+    auto channel = context->open_batched_channel<SimpleMessage>(
+        [](const SimpleMessage&) {}, 4);
+
+    // Capacity rounds to a power of two; a full ring rejects sends
+    EXPECT_EQ(channel->capacity(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(channel->try_send(SimpleMessage{i, "fill"}));
+    }
+    EXPECT_FALSE(channel->try_send(SimpleMessage{99, "overflow"}));
+
+    // Draining frees space again
+    io_context.restart();
+    io_context.run();
+    EXPECT_TRUE(channel->try_send(SimpleMessage{5, "after"}));
+
+    channel->close();
+    EXPECT_FALSE(channel->try_send(SimpleMessage{6, "closed"}));
+}
+
+TEST_F(MessagingTest, AwaitableReceive) {
+    asio::io_context io_context;
+    auto context = std::make_shared<ThreadMessagingContext>("coro_thread", io_context);
+    context->start();
+
+    std::atomic<int> received_value{0};
+    std::atomic<int> handler_count{0};
+
+    // A subscribed handler only sees messages no coroutine is awaiting
+    context->subscribe<SimpleMessage>([&handler_count](const SimpleMessage&) {
+        handler_count++;
+    });
+
+    asio::co_spawn(io_context,
+        [&]() -> asio::awaitable<void> {
+            auto msg = co_await context->async_receive<SimpleMessage>();
+            received_value = msg.value;
+        },
+        asio::detached);
+
+    // Let the coroutine register its pending receiver, then send
+    io_context.restart();
+    io_context.poll();
+    context->send_message(SimpleMessage{42, "awaited"});
+    io_context.run();
+
+    EXPECT_EQ(received_value.load(), 42);
+    EXPECT_EQ(handler_count.load(), 0);
+
+    // With no pending receiver the subscribed handler gets the message
+    context->send_message(SimpleMessage{7, "handled"});
+    io_context.restart();
+    io_context.run();
+    EXPECT_EQ(handler_count.load(), 1);
+
+    context->stop();
+}
+
+TEST_F(MessagingTest, TopicPublishSubscribe) {
+    asio::io_context io_context1, io_context2, io_context3;
+    auto sub1 = std::make_shared<ThreadMessagingContext>("topic_sub1", io_context1);
+    auto sub2 = std::make_shared<ThreadMessagingContext>("topic_sub2", io_context2);
+    auto other = std::make_shared<ThreadMessagingContext>("topic_other", io_context3);
+
+    using SharedMessage = std::shared_ptr<const SimpleMessage>;
+    std::atomic<int> sub1_received{0}, sub2_received{0}, other_received{0};
+    const SimpleMessage* delivered_ptr1 = nullptr;
+    const SimpleMessage* delivered_ptr2 = nullptr;
+
+    sub1->subscribe<SharedMessage>([&](const SharedMessage& msg) {
+        sub1_received++;
+        delivered_ptr1 = msg.get();
+    });
+    sub2->subscribe<SharedMessage>([&](const SharedMessage& msg) {
+        sub2_received++;
+        delivered_ptr2 = msg.get();
+    });
+    other->subscribe<SharedMessage>([&](const SharedMessage&) { other_received++; });
+
+    sub1->start();
+    sub2->start();
+    other->start();
+
+    auto& bus = InterThreadMessagingBus::instance();
+    EXPECT_TRUE(bus.subscribe_topic("market", "topic_sub1"));
+    EXPECT_TRUE(bus.subscribe_topic("market", "topic_sub2"));
+    EXPECT_FALSE(bus.subscribe_topic("market", "not_registered"));
+    EXPECT_EQ(bus.topic_subscriber_count("market"), 2u);
+
+    auto payload = std::make_shared<const SimpleMessage>(42, "tick");
+    EXPECT_EQ(bus.publish("market", payload), 2u);
+
+    io_context1.run();
+    io_context2.run();
+    io_context3.run();
+
+    EXPECT_EQ(sub1_received.load(), 1);
+    EXPECT_EQ(sub2_received.load(), 1);
+    EXPECT_EQ(other_received.load(), 0);
+
+    // Both subscribers saw the very same payload object — no copies
+    EXPECT_EQ(delivered_ptr1, payload.get());
+    EXPECT_EQ(delivered_ptr2, payload.get());
+
+    bus.unsubscribe_topic("market", "topic_sub1");
+    EXPECT_EQ(bus.topic_subscriber_count("market"), 1u);
+    EXPECT_EQ(bus.publish("market", payload), 1u);
+
+    sub1->stop();
+    sub2->stop();
+    other->stop();
+    EXPECT_EQ(bus.topic_subscriber_count("market"), 0u);
+}
+
 TEST_F(MessagingTest, MessagingBusPerformance) {
     constexpr int NUM_MESSAGES = 1000;
 
@@ -0,0 +1,178 @@
+/*
+ * @file test_metrics.cpp
+ * @brief Tests for the process-wide metrics registry
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include "metrics.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace base;
+
+class MetricsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        MetricsRegistry::instance().reset();
+    }
+
+    void TearDown() override {
+        MetricsRegistry::instance().reset();
+    }
+
+    // Snapshot lookup helper; registry is shared across the process so
+    // tests assert on their own names only
+    static const MetricSample* find_sample(const std::vector<MetricSample>& samples,
+                                           const std::string& name) {
+        auto it = std::find_if(samples.begin(), samples.end(),
+                               [&name](const MetricSample& sample) {
+                                   return sample.name == name;
+                               });
+        return it != samples.end() ? &*it : nullptr;
+    }
+};
+
+TEST_F(MetricsTest, CounterIncrementAndSnapshot) {
+    auto& counter = MetricsRegistry::instance().counter("test.counter");
+    counter.increment();
+    counter.increment(41);
+
+    EXPECT_EQ(counter.value(), 42);
+
+    auto samples = MetricsRegistry::instance().snapshot();
+    const auto* sample = find_sample(samples, "test.counter");
+    ASSERT_NE(sample, nullptr);
+    EXPECT_EQ(sample->kind, MetricSample::Kind::Counter);
+    EXPECT_EQ(sample->value, 42);
+}
+
+TEST_F(MetricsTest, SameNameReturnsSameMetric) {
+    auto& first = MetricsRegistry::instance().counter("test.same");
+    auto& second = MetricsRegistry::instance().counter("test.same");
+    EXPECT_EQ(&first, &second);
+
+    first.increment();
+    EXPECT_EQ(second.value(), 1);
+}
+
+TEST_F(MetricsTest, GaugeMovesBothDirections) {
+    auto& gauge = MetricsRegistry::instance().gauge("test.gauge");
+    gauge.set(100);
+    gauge.add(-30);
+
+    EXPECT_EQ(gauge.value(), 70);
+
+    auto samples = MetricsRegistry::instance().snapshot();
+    const auto* sample = find_sample(samples, "test.gauge");
+    ASSERT_NE(sample, nullptr);
+    EXPECT_EQ(sample->kind, MetricSample::Kind::Gauge);
+    EXPECT_EQ(sample->value, 70);
+}
+
+TEST_F(MetricsTest, HistogramBucketsAndPercentiles) {
+    auto& histogram = MetricsRegistry::instance().histogram("test.histogram");
+
+    // 90 small samples and 10 large ones
+    for (int i = 0; i < 90; ++i) {
+        histogram.record(10);
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.record(10000);
+    }
+
+    EXPECT_EQ(histogram.count(), 100);
+    EXPECT_EQ(histogram.sum(), 90 * 10 + 10 * 10000);
+
+    // Power-of-two buckets: the answer is the bucket upper bound, so the
+    // approximation is within a factor of two of the true value
+    EXPECT_LE(histogram.percentile(0.50), 15);
+    EXPECT_GE(histogram.percentile(0.99), 8192);
+    EXPECT_LE(histogram.percentile(0.99), 16383);
+}
+
+TEST_F(MetricsTest, ProviderSampledAtSnapshotTime) {
+    std::int64_t current = 7;
+    auto id = MetricsRegistry::instance().register_provider(
+        "test.provider", [&current]() { return current; });
+
+    auto samples = MetricsRegistry::instance().snapshot();
+    const auto* sample = find_sample(samples, "test.provider");
+    ASSERT_NE(sample, nullptr);
+    EXPECT_EQ(sample->value, 7);
+
+    current = 8;
+    samples = MetricsRegistry::instance().snapshot();
+    EXPECT_EQ(find_sample(samples, "test.provider")->value, 8);
+
+    MetricsRegistry::instance().unregister_provider(id);
+    samples = MetricsRegistry::instance().snapshot();
+    EXPECT_EQ(find_sample(samples, "test.provider"), nullptr);
+}
+
+TEST_F(MetricsTest, ThrowingProviderSkipsItsSampleOnly) {
+    auto& counter = MetricsRegistry::instance().counter("test.survivor");
+    counter.increment();
+
+    auto id = MetricsRegistry::instance().register_provider(
+        "test.broken", []() -> std::int64_t { throw std::runtime_error("unavailable"); });
+
+    auto samples = MetricsRegistry::instance().snapshot();
+    EXPECT_EQ(find_sample(samples, "test.broken"), nullptr);
+    ASSERT_NE(find_sample(samples, "test.survivor"), nullptr);
+
+    MetricsRegistry::instance().unregister_provider(id);
+}
+
+TEST_F(MetricsTest, ResetZeroesMetrics) {
+    MetricsRegistry::instance().counter("test.reset.counter").increment(5);
+    MetricsRegistry::instance().gauge("test.reset.gauge").set(5);
+    MetricsRegistry::instance().histogram("test.reset.histogram").record(5);
+
+    MetricsRegistry::instance().reset();
+
+    auto samples = MetricsRegistry::instance().snapshot();
+    EXPECT_EQ(find_sample(samples, "test.reset.counter")->value, 0);
+    EXPECT_EQ(find_sample(samples, "test.reset.gauge")->value, 0);
+    EXPECT_EQ(find_sample(samples, "test.reset.histogram")->count, 0);
+}
+
+TEST_F(MetricsTest, ConcurrentUpdates) {
+    auto& counter = MetricsRegistry::instance().counter("test.concurrent");
+    auto& histogram = MetricsRegistry::instance().histogram("test.concurrent.hist");
+
+    constexpr int THREADS = 4;
+    constexpr int ITERATIONS = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&counter, &histogram]() {
+            for (int i = 0; i < ITERATIONS; ++i) {
+                counter.increment();
+                histogram.record(static_cast<std::uint64_t>(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.value(), THREADS * ITERATIONS);
+    EXPECT_EQ(histogram.count(), THREADS * ITERATIONS);
+}
+
+TEST_F(MetricsTest, SnapshotIsSortedByName) {
+    MetricsRegistry::instance().counter("test.sort.b");
+    MetricsRegistry::instance().counter("test.sort.a");
+    MetricsRegistry::instance().gauge("test.sort.c");
+
+    auto samples = MetricsRegistry::instance().snapshot();
+    EXPECT_TRUE(std::is_sorted(samples.begin(), samples.end(),
+                               [](const MetricSample& a, const MetricSample& b) {
+                                   return a.name < b.name;
+                               }));
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include "logger.h"
+#include "shm_messaging.h"
+
+#include <asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+using namespace base;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct SensorReading {
+    int sensor_id;
+    double value;
+};
+
+struct ControlCommand {
+    int command_id;
+};
+
+static_assert(ShmMessageType<SensorReading>);
+
+} // namespace
+
+class ShmMessagingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Logger::init();
+        // Stale segments from an aborted run would replay old messages
+        SharedMemoryTransport::remove_segments("shm_test_a", "shm_test_b");
+    }
+
+    void TearDown() override {
+        SharedMemoryTransport::remove_segments("shm_test_a", "shm_test_b");
+        Logger::shutdown();
+    }
+
+    // Runs the io_context until the predicate holds or the deadline passes
+    template<typename Predicate>
+    bool run_until(Predicate predicate, std::chrono::milliseconds deadline = 2000ms) {
+        auto start = std::chrono::steady_clock::now();
+        while (!predicate()) {
+            if (std::chrono::steady_clock::now() - start > deadline) {
+                return false;
+            }
+            io_context_.run_for(10ms);
+            io_context_.restart();
+        }
+        return true;
+    }
+
+    asio::io_context io_context_;
+};
+
+TEST_F(ShmMessagingTest, RoundTripDelivery) {
+    SharedMemoryTransport sender("shm_test_a", "shm_test_b", io_context_);
+    SharedMemoryTransport receiver("shm_test_b", "shm_test_a", io_context_);
+
+    std::atomic<int> received{0};
+    SensorReading last{};
+    receiver.subscribe<SensorReading>([&](const SensorReading& reading) {
+        last = reading;
+        received.fetch_add(1);
+    });
+
+    ASSERT_TRUE(sender.start());
+    ASSERT_TRUE(receiver.start());
+
+    EXPECT_TRUE(sender.send_message(SensorReading{7, 3.5}));
+    EXPECT_TRUE(sender.send_message(SensorReading{8, 4.5}));
+
+    EXPECT_TRUE(run_until([&]() { return received.load() == 2; }));
+    EXPECT_EQ(last.sensor_id, 8);
+    EXPECT_DOUBLE_EQ(last.value, 4.5);
+
+    sender.stop();
+    receiver.stop();
+}
+
+TEST_F(ShmMessagingTest, FullRingAppliesBackpressure) {
+    // Capacity rounds up to the 4096-byte minimum; each record costs
+    // the 16-byte header plus the padded payload
+    SharedMemoryTransport sender("shm_test_a", "shm_test_b", io_context_, 1);
+    ASSERT_TRUE(sender.start());
+
+    std::size_t accepted = 0;
+    while (sender.send_message(SensorReading{1, 1.0})) {
+        ++accepted;
+        ASSERT_LT(accepted, 10000u) << "Ring never reported full";
+    }
+    EXPECT_GT(accepted, 0u);
+
+    // Still full without a consumer draining
+    EXPECT_FALSE(sender.send_message(SensorReading{2, 2.0}));
+    sender.stop();
+}
+
+TEST_F(ShmMessagingTest, UnsubscribedTypesAreDropped) {
+    SharedMemoryTransport sender("shm_test_a", "shm_test_b", io_context_);
+    SharedMemoryTransport receiver("shm_test_b", "shm_test_a", io_context_);
+
+    std::atomic<int> commands{0};
+    receiver.subscribe<ControlCommand>([&](const ControlCommand&) {
+        commands.fetch_add(1);
+    });
+
+    ASSERT_TRUE(sender.start());
+    ASSERT_TRUE(receiver.start());
+
+    // The reading has no subscriber and must not block the command behind it
+    EXPECT_TRUE(sender.send_message(SensorReading{1, 1.0}));
+    EXPECT_TRUE(sender.send_message(ControlCommand{42}));
+
+    EXPECT_TRUE(run_until([&]() { return commands.load() == 1; }));
+
+    sender.stop();
+    receiver.stop();
+}
+
+TEST_F(ShmMessagingTest, StoppedTransportRejectsSends) {
+    SharedMemoryTransport sender("shm_test_a", "shm_test_b", io_context_);
+    EXPECT_FALSE(sender.send_message(SensorReading{1, 1.0}));
+
+    ASSERT_TRUE(sender.start());
+    EXPECT_TRUE(sender.send_message(SensorReading{1, 1.0}));
+
+    sender.stop();
+    EXPECT_FALSE(sender.send_message(SensorReading{1, 1.0}));
+}
+
+TEST_F(ShmMessagingTest, CapacityMismatchKeepsInitializerSize) {
+    constexpr std::size_t LARGE_CAPACITY = 1 << 16;
+    const std::string segment = "/base_shm_test_mismatch";
+    ShmRing::unlink(segment);
+
+    ShmRing initializer;
+    ASSERT_TRUE(initializer.open(segment, LARGE_CAPACITY));
+
+    // Fill past what a smaller attacher could hold; a shrinking attach
+    // would truncate this data out from under us
+    const std::vector<unsigned char> payload(8192, 0xAB);
+    std::size_t written = 0;
+    while (initializer.write(1, payload.data(), payload.size())) {
+        ++written;
+    }
+    ASSERT_GT(written, 2u);
+
+    // Attaching with a smaller request must adopt the initializer's
+    // capacity instead of resizing the live segment
+    ShmRing attacher;
+    ASSERT_TRUE(attacher.open(segment, 4096));
+
+    std::size_t drained = 0;
+    attacher.drain(
+        [&](std::uint64_t type_hash, const unsigned char* data, std::size_t size) {
+            EXPECT_EQ(type_hash, 1u);
+            ASSERT_EQ(size, payload.size());
+            EXPECT_EQ(0, std::memcmp(data, payload.data(), size));
+            ++drained;
+        },
+        written);
+    EXPECT_EQ(drained, written);
+
+    attacher.close();
+    initializer.close();
+    ShmRing::unlink(segment);
+}
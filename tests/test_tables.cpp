@@ -361,6 +361,90 @@ TEST_F(TableTest, TableSerialization) {
     EXPECT_EQ(table->get_row_count(), original_count);
 }
 
+TEST_F(TableTest, BinaryFileRoundTrip) {
+    auto table = createTestTable();
+
+    table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+    table->insert_row({{"id", 3L}, {"name", std::string("Carol")}, {"email", std::monostate{}}});
+    table->create_index("idx_name", {"name"});
+    table->create_index("idx_age_hash", {"age"}, false, IndexKind::Hash);
+
+    const std::string filename = "/tmp/test_table_binary.btbl";
+    ASSERT_TRUE(table->save_to_binary_file(filename));
+
+    // load_table detects the binary magic
+    auto loaded = TableFactory::load_table(filename);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->get_row_count(), 3);
+    EXPECT_EQ(loaded->get_schema().get_name(), table->get_schema().get_name());
+    EXPECT_EQ(loaded->get_schema().get_columns().size(), 4);
+
+    auto row = loaded->get_row(1);
+    ASSERT_TRUE(row.has_value());
+    EXPECT_EQ(std::get<std::string>(row->get_value("name")), "Alice");
+    EXPECT_EQ(std::get<std::int64_t>(row->get_value("age")), 25);
+
+    // Null cells and indexes survive the round trip
+    auto carol = loaded->get_row(3);
+    ASSERT_TRUE(carol.has_value());
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(carol->get_value("email")));
+    EXPECT_EQ(loaded->find_by_index("idx_name", {std::string("Bob")}).size(), 1);
+    EXPECT_EQ(loaded->find_by_index("idx_age_hash", {static_cast<std::int64_t>(30)}).size(), 1);
+
+    std::remove(filename.c_str());
+}
+
+TEST_F(TableTest, WalAppendAndRecovery) {
+    const std::string wal_path = "/tmp/test_table_wal.bwal";
+    const std::string snapshot_path = "/tmp/test_table_wal.btbl";
+    std::remove(wal_path.c_str());
+    std::remove(snapshot_path.c_str());
+
+    std::size_t bob_id = 0;
+    {
+        auto table = createTestTable();
+        ASSERT_TRUE(table->enable_wal(wal_path));
+        EXPECT_TRUE(table->is_wal_enabled());
+
+        table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+        bob_id = table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+        auto charlie_id = table->insert_row(createSampleRow(3, "Charlie", "", 35));
+        table->update_row(bob_id, {{"age", static_cast<std::int64_t>(31)}});
+        table->delete_row(charlie_id);
+    }
+
+    // Replaying the log alone rebuilds the exact state
+    {
+        auto recovered = createTestTable();
+        ASSERT_TRUE(recovered->recover_from_wal(snapshot_path, wal_path));
+        EXPECT_EQ(recovered->get_row_count(), 2);
+
+        auto bob = recovered->get_row(bob_id);
+        ASSERT_TRUE(bob.has_value());
+        EXPECT_EQ(std::get<std::int64_t>(bob->get_value("age")), 31);
+
+        // Compaction folds state into the snapshot and truncates the log
+        ASSERT_TRUE(recovered->compact_wal(snapshot_path));
+        recovered->insert_row(createSampleRow(4, "Dave", "dave@example.com", 40));
+    }
+
+    // Snapshot plus post-compaction log entries recover together
+    {
+        auto recovered = createTestTable();
+        ASSERT_TRUE(recovered->recover_from_wal(snapshot_path, wal_path));
+        EXPECT_EQ(recovered->get_row_count(), 3);
+        ASSERT_TRUE(recovered->get_row(bob_id).has_value());
+
+        TableQuery query;
+        query.where("name", QueryOperator::Equal, std::string("Dave"));
+        EXPECT_EQ(recovered->query(query).size(), 1);
+    }
+
+    std::remove(wal_path.c_str());
+    std::remove(snapshot_path.c_str());
+}
+
 // ============================================================================
 // Transaction Tests
 // ============================================================================
@@ -482,6 +566,49 @@ TEST_F(TableTest, ConcurrentReadWrite) {
     EXPECT_EQ(table->get_row_count(), 20);
 }
 
+TEST_F(TableTest, ShardedParallelRowOperations) {
+    auto table = createTestTable();
+    const int row_count = 200;
+
+    for (int i = 1; i <= row_count; ++i) {
+        table->insert_row(createSampleRow(i, "User " + std::to_string(i),
+                                          "user" + std::to_string(i) + "@example.com", 20));
+    }
+
+    // Updates and deletes on disjoint row IDs land on different shards and
+    // run in parallel; each thread owns the IDs congruent to its index
+    const int num_threads = 4;
+    std::vector<std::future<void>> futures;
+    for (int t = 0; t < num_threads; ++t) {
+        futures.emplace_back(std::async(std::launch::async, [&, t]() {
+            for (int id = t + 1; id <= row_count; id += num_threads) {
+                if (id % 2 == 0) {
+                    table->update_row(id, {{"age", static_cast<std::int64_t>(30 + t)}});
+                } else {
+                    table->delete_row(id);
+                }
+            }
+        }));
+    }
+    for (auto& future : futures) {
+        future.wait();
+    }
+
+    EXPECT_EQ(table->get_row_count(), row_count / 2);
+    for (int id = 2; id <= row_count; id += 2) {
+        auto row = table->get_row(id);
+        ASSERT_TRUE(row.has_value());
+        EXPECT_GE(std::get<std::int64_t>(row->get_value("age")), 30);
+    }
+
+    // Iteration visits every surviving row exactly once across shards
+    std::set<std::size_t> seen;
+    for (const auto& row : *table) {
+        seen.insert(row.get_id());
+    }
+    EXPECT_EQ(seen.size(), table->get_row_count());
+}
+
 // ============================================================================
 // Performance Tests
 // ============================================================================
@@ -1065,6 +1192,58 @@ TEST_F(TableTest, TablePagerBasics) {
     EXPECT_NE(first_page, second_page);
 }
 
+TEST_F(TableTest, TableStreamProducer) {
+    auto table = createTestTable();
+
+    for (int i = 1; i <= 20; ++i) {
+        table->insert_row({
+            {"id", static_cast<int64_t>(i)},
+            {"name", std::string("User") + std::to_string(i)},
+            {"email", std::string("user") + std::to_string(i) + "@test.com"},
+            {"age", static_cast<int64_t>(20 + i)}
+        });
+    }
+
+    TableDumpOptions options;
+    options.page_size = 5;  // 5 rows per page -> 4 chunks
+
+    auto producer = table->create_stream_producer(options);
+
+    std::string chunk;
+    std::string combined;
+    std::size_t chunk_count = 0;
+    while (producer(chunk)) {
+        EXPECT_FALSE(chunk.empty());
+        combined += chunk;
+        ++chunk_count;
+    }
+
+    EXPECT_EQ(chunk_count, 4);
+    // Exhausted producer stays exhausted
+    EXPECT_FALSE(producer(chunk));
+
+    // Every row appears across the chunks
+    for (int i = 1; i <= 20; ++i) {
+        EXPECT_NE(combined.find("User" + std::to_string(i)), std::string::npos);
+    }
+}
+
+TEST_F(TableTest, TableStreamProducerUnpagedFallsBackToDefaultPageSize) {
+    auto table = createTestTable();
+    table->insert_row({{"id", 1L}, {"name", std::string("John")}, {"email", std::string("john@test.com")}, {"age", 30L}});
+
+    // page_size 0 must not degenerate into a single unbounded chunk
+    TableDumpOptions options;
+    options.page_size = 0;
+
+    auto producer = table->create_stream_producer(options);
+
+    std::string chunk;
+    EXPECT_TRUE(producer(chunk));
+    EXPECT_NE(chunk.find("John"), std::string::npos);
+    EXPECT_FALSE(producer(chunk));
+}
+
 TEST_F(TableTest, TableDumpWithFiltering) {
     auto table = createTestTable();
 
@@ -1127,6 +1306,518 @@ TEST_F(TableTest, TablePrintMethods) {
     EXPECT_TRUE(stream_output.find("Jane") != std::string::npos);
 }
 
+TEST_F(TableTest, BatchedChangeEventDelivery) {
+    auto table = createTestTable();
+
+    std::vector<std::size_t> batch_sizes;
+    std::vector<ChangeSummary> received_summaries;
+    table->add_batch_change_callback("batcher", [&](const std::vector<ChangeEvent>& events) {
+        batch_sizes.push_back(events.size());
+    });
+    table->add_change_summary_callback("summarizer", [&](const std::vector<ChangeSummary>& summaries) {
+        received_summaries.insert(received_summaries.end(), summaries.begin(), summaries.end());
+    });
+
+    table->enable_change_event_queue();
+    table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+    table->update_row(1, {{"age", static_cast<std::int64_t>(26)}});
+
+    // Nothing is delivered until the consumer drains
+    EXPECT_TRUE(batch_sizes.empty());
+
+    EXPECT_EQ(table->drain_change_events(), 3);
+    ASSERT_EQ(batch_sizes.size(), 1);
+    EXPECT_EQ(batch_sizes[0], 3);
+    ASSERT_EQ(received_summaries.size(), 3);
+
+    // The update summary carries only the changed column
+    const auto& update_summary = received_summaries[2];
+    EXPECT_EQ(update_summary.type, ChangeType::RowUpdated);
+    EXPECT_EQ(update_summary.row_id, 1);
+    ASSERT_EQ(update_summary.changed_columns.size(), 1);
+    EXPECT_EQ(update_summary.changed_columns[0], ColumnRegistry::intern("age"));
+
+    // An empty queue drains to nothing
+    EXPECT_EQ(table->drain_change_events(), 0);
+
+    // A full queue drops new events instead of stalling the writer
+    table->disable_change_event_queue();
+    table->enable_change_event_queue(2, ChangeQueueMode::SummariesOnly);
+    table->insert_row(createSampleRow(3, "Carol", "carol@example.com", 31));
+    table->insert_row(createSampleRow(4, "Dave", "dave@example.com", 32));
+    table->insert_row(createSampleRow(5, "Eve", "eve@example.com", 33));
+    EXPECT_EQ(table->dropped_change_events(), 1);
+
+    received_summaries.clear();
+    batch_sizes.clear();
+    EXPECT_EQ(table->drain_change_events(), 2);
+    EXPECT_EQ(received_summaries.size(), 2);
+    EXPECT_TRUE(batch_sizes.empty());  // Summaries-only mode queues no full events
+}
+
+TEST_F(TableTest, SnapshotIsolation) {
+    auto table = createTestTable();
+    table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+
+    auto snapshot = table->snapshot();
+    EXPECT_EQ(snapshot.size(), 2);
+
+    // Writers proceed; the snapshot stays at its capture point
+    table->insert_row(createSampleRow(3, "Charlie", "charlie@example.com", 35));
+    table->update_row(1, {{"age", static_cast<std::int64_t>(26)}});
+    table->delete_row(2);
+
+    EXPECT_EQ(snapshot.size(), 2);
+    ASSERT_NE(snapshot.get_row(1), nullptr);
+    EXPECT_EQ(std::get<std::int64_t>(snapshot.get_row(1)->get_value("age")), 25);
+    ASSERT_NE(snapshot.get_row(2), nullptr);
+    EXPECT_EQ(snapshot.get_row(3), nullptr);
+
+    // A fresh snapshot sees the new state and a newer version
+    auto fresh = table->snapshot();
+    EXPECT_GT(fresh.version(), snapshot.version());
+    EXPECT_EQ(fresh.size(), 2);
+    EXPECT_EQ(fresh.get_row(2), nullptr);
+
+    // While the table is quiescent, snapshots reuse the cached backing data
+    auto again = table->snapshot();
+    EXPECT_EQ(again.version(), fresh.version());
+}
+
+TEST_F(TableTest, TransactionStagedCommitAndConflict) {
+    auto table = createTestTable();
+    table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+
+    // Staged operations touch nothing until commit
+    auto txn = table->begin_transaction();
+    txn->begin();
+    txn->insert_row(createSampleRow(3, "Charlie", "charlie@example.com", 35));
+    EXPECT_TRUE(txn->update_row(1, {{"age", static_cast<std::int64_t>(26)}}));
+    EXPECT_TRUE(txn->delete_row(2));
+    EXPECT_FALSE(txn->update_row(99, {{"age", static_cast<std::int64_t>(1)}}));
+
+    EXPECT_EQ(table->get_row_count(), 2);
+    EXPECT_EQ(std::get<std::int64_t>(table->get_row(1)->get_value("age")), 25);
+
+    txn->commit();
+    EXPECT_TRUE(txn->is_committed());
+    EXPECT_EQ(table->get_row_count(), 2);  // +1 insert, -1 delete
+    EXPECT_EQ(std::get<std::int64_t>(table->get_row(1)->get_value("age")), 26);
+    EXPECT_FALSE(table->get_row(2).has_value());
+
+    TableQuery charlie_query;
+    charlie_query.where("name", QueryOperator::Equal, std::string("Charlie"));
+    EXPECT_EQ(table->query(charlie_query).size(), 1);
+
+    // First committer wins: a transaction whose touched row moved on loses
+    auto loser = table->begin_transaction();
+    loser->begin();
+    EXPECT_TRUE(loser->update_row(1, {{"age", static_cast<std::int64_t>(50)}}));
+    table->update_row(1, {{"age", static_cast<std::int64_t>(27)}});
+    EXPECT_THROW(loser->commit(), std::runtime_error);
+    EXPECT_TRUE(loser->is_rolled_back());
+    EXPECT_EQ(std::get<std::int64_t>(table->get_row(1)->get_value("age")), 27);
+
+    // Rollback discards staged work
+    auto discarded = table->begin_transaction();
+    discarded->begin();
+    discarded->insert_row(createSampleRow(10, "Eve", "eve@example.com", 40));
+    discarded->rollback();
+    EXPECT_EQ(table->get_row_count(), 2);
+}
+
+TEST_F(TableTest, ZeroCopyResultViews) {
+    auto table = createTestTable();
+    for (int i = 1; i <= 20; ++i) {
+        table->insert_row(createSampleRow(i, "User" + std::to_string(i),
+                                          "user" + std::to_string(i) + "@example.com", 20 + i));
+    }
+
+    {
+        auto view = table->get_all_rows_view();
+        EXPECT_EQ(view.size(), 20);
+        std::size_t visited = 0;
+        for (const auto& row : view) {
+            EXPECT_FALSE(std::get<std::string>(row.get_value("name")).empty());
+            ++visited;
+        }
+        EXPECT_EQ(visited, 20);
+
+        // materialize() hands out owned copies that survive the view
+        auto owned = view.materialize();
+        EXPECT_EQ(owned.size(), 20);
+        EXPECT_THROW(view.at(20), std::out_of_range);
+    }
+
+    {
+        TableQuery filtered_query;
+        filtered_query.where("age", QueryOperator::GreaterThan, static_cast<std::int64_t>(30))
+                      .order_by("age", false)
+                      .limit(3);
+        auto view = table->query_view(filtered_query);
+        ASSERT_EQ(view.size(), 3);
+        EXPECT_EQ(std::get<std::int64_t>(view[0].get_value("age")), 40);
+        EXPECT_EQ(std::get<std::int64_t>(view[2].get_value("age")), 38);
+    }
+
+    // Views must be dropped before mutating; afterwards writes proceed
+    table->insert_row(createSampleRow(21, "User21", "user21@example.com", 55));
+    EXPECT_EQ(table->get_row_count(), 21);
+
+    // ColumnStore tables serve views from materialized backing rows
+    auto columnar = std::make_unique<Table>(
+        std::make_unique<TableSchema>(table->get_schema()), StorageEngine::ColumnStore);
+    columnar->insert_row(createSampleRow(1, "Alice", "alice@example.com", 30));
+    auto columnar_view = columnar->get_all_rows_view();
+    ASSERT_EQ(columnar_view.size(), 1);
+    EXPECT_EQ(std::get<std::string>(columnar_view[0].get_value("name")), "Alice");
+}
+
+TEST_F(TableTest, BulkInsertRows) {
+    auto table = createTestTable();
+    table->create_index("idx_email", {"email"}, true);
+
+    std::size_t event_count = 0;
+    ChangeEvent last_event(ChangeType::RowInserted, "");
+    table->add_change_callback("bulk_watcher", [&](const ChangeEvent& event) {
+        ++event_count;
+        last_event = event;
+    });
+
+    std::vector<std::unordered_map<std::string, CellValue>> batch;
+    for (int i = 1; i <= 50; ++i) {
+        batch.push_back(createSampleRow(i, "User" + std::to_string(i),
+                                        "user" + std::to_string(i) + "@example.com", 20 + i));
+    }
+
+    auto row_ids = table->insert_rows(batch);
+    ASSERT_EQ(row_ids.size(), 50);
+    EXPECT_EQ(table->get_row_count(), 50);
+    EXPECT_EQ(row_ids.back(), row_ids.front() + 49);
+
+    // One batched event for the whole batch
+    EXPECT_EQ(event_count, 1);
+    EXPECT_EQ(last_event.type, ChangeType::RowsBulkInserted);
+    EXPECT_EQ(last_event.row_id, row_ids.front());
+    EXPECT_EQ(std::get<std::int64_t>(last_event.new_values.at("row_count")), 50);
+
+    // Indexes see the batch
+    TableQuery indexed_query;
+    indexed_query.where("email", QueryOperator::Equal, std::string("user7@example.com"));
+    EXPECT_EQ(table->query(indexed_query).size(), 1);
+
+    // A unique violation mid-batch rejects the whole batch
+    std::vector<std::unordered_map<std::string, CellValue>> bad_batch;
+    bad_batch.push_back(createSampleRow(51, "Eve", "eve@example.com", 30));
+    bad_batch.push_back(createSampleRow(52, "Mallory", "user7@example.com", 31));
+    EXPECT_THROW(table->insert_rows(bad_batch), std::runtime_error);
+    EXPECT_EQ(table->get_row_count(), 50);
+
+    TableQuery eve_query;
+    eve_query.where("email", QueryOperator::Equal, std::string("eve@example.com"));
+    EXPECT_TRUE(table->query(eve_query).empty());
+
+    // Empty batch is a no-op
+    EXPECT_TRUE(table->insert_rows({}).empty());
+}
+
+TEST_F(TableTest, TopNHeapOrderedLimit) {
+    auto table = createTestTable();
+
+    for (int i = 0; i < 100; ++i) {
+        table->insert_row(createSampleRow(i + 1, "User" + std::to_string(i + 1),
+                                          "user" + std::to_string(i + 1) + "@example.com",
+                                          20 + (i * 37) % 60));
+    }
+
+    // Bounded limit takes the heap path; result must match a full sort
+    TableQuery top_query;
+    top_query.order_by("age", false).limit(5);
+    auto top_results = table->query(top_query);
+    ASSERT_EQ(top_results.size(), 5);
+    for (std::size_t i = 1; i < top_results.size(); ++i) {
+        EXPECT_GE(std::get<std::int64_t>(top_results[i - 1].get_value("age")),
+                  std::get<std::int64_t>(top_results[i].get_value("age")));
+    }
+
+    TableQuery full_query;
+    full_query.order_by("age", false);
+    auto full_results = table->query(full_query);
+    ASSERT_GE(full_results.size(), 5);
+    for (std::size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(top_results[i].get_value("age"), full_results[i].get_value("age"));
+    }
+
+    // Offset rows are retained by the heap so pagination stays correct
+    TableQuery paged_query;
+    paged_query.order_by("id", true).limit(10).offset(90);
+    auto paged_results = table->query(paged_query);
+    ASSERT_EQ(paged_results.size(), 10);
+    EXPECT_EQ(std::get<std::int64_t>(paged_results.front().get_value("id")), 91);
+    EXPECT_EQ(std::get<std::int64_t>(paged_results.back().get_value("id")), 100);
+
+    // Limit wider than the table falls back to the plain sort path
+    TableQuery wide_query;
+    wide_query.order_by("id", false).limit(1000);
+    EXPECT_EQ(table->query(wide_query).size(), 100);
+}
+
+TEST_F(TableTest, BatchedPredicateEvaluation) {
+    auto table = createTestTable();
+
+    table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+    table->insert_row(createSampleRow(3, "Charlie", "", 35));
+    table->insert_row(createSampleRow(4, "Dave", "dave@example.com"));  // age absent
+
+    // Typed pass and generic fallback combine across conditions
+    TableQuery mixed_query;
+    mixed_query.where("age", QueryOperator::GreaterThanOrEqual, static_cast<std::int64_t>(30))
+               .where("email", QueryOperator::Like, std::string("@example.com"));
+    auto mixed_results = table->query(mixed_query);
+    ASSERT_EQ(mixed_results.size(), 1);
+    EXPECT_EQ(std::get<std::string>(mixed_results[0].get_value("name")), "Bob");
+
+    // Rows without the column never match typed comparisons
+    TableQuery typed_query;
+    typed_query.where("age", QueryOperator::NotEqual, static_cast<std::int64_t>(25));
+    EXPECT_EQ(table->query(typed_query).size(), 2);  // Bob and Charlie; Dave has no age
+
+    // Type-mismatched predicate values match nothing, as before
+    TableQuery mismatched_query;
+    mismatched_query.where("age", QueryOperator::Equal, std::string("30"));
+    EXPECT_TRUE(table->query(mismatched_query).empty());
+}
+
+TEST_F(TableTest, QueryPlannerUsesIndexes) {
+    auto table = createTestTable();
+
+    table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+    table->insert_row(createSampleRow(3, "Charlie", "charlie@example.com", 35));
+    table->insert_row(createSampleRow(4, "Alice", "alice2@example.com", 40));
+
+    table->create_index("idx_name", {"name"});
+    table->create_index("idx_age", {"age"});
+
+    // Point query on an indexed column is served from the index
+    TableQuery point_query;
+    point_query.where("name", QueryOperator::Equal, std::string("Alice"));
+    auto point_results = table->query(point_query);
+    EXPECT_EQ(point_results.size(), 2);
+
+    // Residual predicates still filter index candidates
+    TableQuery residual_query;
+    residual_query.where("name", QueryOperator::Equal, std::string("Alice"))
+                  .where("age", QueryOperator::GreaterThan, static_cast<std::int64_t>(30));
+    auto residual_results = table->query(residual_query);
+    ASSERT_EQ(residual_results.size(), 1);
+    EXPECT_EQ(std::get<std::int64_t>(residual_results[0].get_value("age")), 40);
+
+    // Bounded range predicates use find_range on the ordered index;
+    // strict bounds are re-applied by the residual filter
+    TableQuery range_query;
+    range_query.where("age", QueryOperator::GreaterThan, static_cast<std::int64_t>(25))
+               .where("age", QueryOperator::LessThanOrEqual, static_cast<std::int64_t>(35))
+               .order_by("age", true);
+    auto range_results = table->query(range_query);
+    ASSERT_EQ(range_results.size(), 2);
+    EXPECT_EQ(std::get<std::int64_t>(range_results[0].get_value("age")), 30);
+    EXPECT_EQ(std::get<std::int64_t>(range_results[1].get_value("age")), 35);
+
+    // Queries on unindexed columns still fall back to scanning
+    TableQuery scan_query;
+    scan_query.where("email", QueryOperator::Equal, std::string("bob@example.com"));
+    auto scan_results = table->query(scan_query);
+    ASSERT_EQ(scan_results.size(), 1);
+    EXPECT_EQ(std::get<std::string>(scan_results[0].get_value("name")), "Bob");
+}
+
+TEST_F(TableTest, HashIndexLookups) {
+    auto table = createTestTable();
+
+    table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+    table->insert_row(createSampleRow(3, "Alice", "alice2@example.com", 35));
+
+    table->create_index("idx_name_hash", {"name"}, false, IndexKind::Hash);
+
+    // Equality lookups resolve through a single hash probe
+    auto results = table->find_by_index("idx_name_hash", {std::string("Alice")});
+    EXPECT_EQ(results.size(), 2);
+
+    auto missing = table->find_by_index("idx_name_hash", {std::string("Eve")});
+    EXPECT_TRUE(missing.empty());
+
+    // Hash indexes track mutations like ordered ones
+    table->insert_row(createSampleRow(4, "Eve", "eve@example.com", 40));
+    EXPECT_EQ(table->find_by_index("idx_name_hash", {std::string("Eve")}).size(), 1);
+
+    // Unique hash indexes enforce the constraint
+    table->create_index("idx_email_hash", {"email"}, true, IndexKind::Hash);
+    EXPECT_THROW(table->insert_row(createSampleRow(5, "Mallory", "eve@example.com", 41)),
+                 std::runtime_error);
+}
+
+TEST_F(TableTest, InternedColumnIds) {
+    auto table = createTestTable();
+
+    // Schema assigns stable IDs at add_column time
+    auto name_id = table->get_schema().get_column_id("name");
+    auto age_id = table->get_schema().get_column_id("age");
+    ASSERT_TRUE(name_id.has_value());
+    ASSERT_TRUE(age_id.has_value());
+    EXPECT_NE(*name_id, *age_id);
+    EXPECT_EQ(ColumnRegistry::intern("name"), *name_id);
+    EXPECT_EQ(ColumnRegistry::name_of(*name_id), "name");
+
+    auto row_id = table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+
+    // ID-keyed accessors match the string-keyed compatibility layer
+    auto row = table->get_row(row_id);
+    ASSERT_TRUE(row.has_value());
+    EXPECT_TRUE(row->has_column(*name_id));
+    EXPECT_EQ(std::get<std::string>(row->get_value(*name_id)), "Alice");
+    EXPECT_EQ(row->get_value(*age_id), row->get_value("age"));
+
+    // Queries can be built directly against column IDs
+    TableQuery query;
+    query.where(*age_id, QueryOperator::GreaterThan, static_cast<std::int64_t>(28));
+    auto results = table->query(query);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(std::get<std::string>(results[0].get_value("name")), "Bob");
+}
+
+TEST_F(TableTest, PooledRowRecycling) {
+    auto table = createTestTable();
+
+    // Repeated insert/delete cycles exercise the row pool free list
+    for (int cycle = 0; cycle < 3; ++cycle) {
+        std::vector<std::size_t> ids;
+        for (int i = 0; i < 100; ++i) {
+            ids.push_back(table->insert_row(
+                createSampleRow(cycle * 1000 + i, "User" + std::to_string(i), "", 20 + (i % 50))));
+        }
+        EXPECT_EQ(table->get_row_count(), 100);
+
+        for (auto id : ids) {
+            EXPECT_TRUE(table->delete_row(id));
+        }
+        EXPECT_TRUE(table->empty());
+    }
+
+    // clear() reclaims pool slabs in bulk; table must stay usable afterwards
+    table->insert_row(createSampleRow(1, "Alice"));
+    table->clear();
+    EXPECT_TRUE(table->empty());
+
+    auto id = table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+    auto row = table->get_row(id);
+    ASSERT_TRUE(row.has_value());
+    EXPECT_EQ(std::get<std::string>(row->get_value("name")), "Bob");
+}
+
+// ============================================================================
+// Columnar Storage Tests
+// ============================================================================
+
+TEST_F(TableTest, ColumnarTableBasicOperations) {
+    std::vector<ColumnDefinition> columns = {
+        ColumnDefinition("id", ColumnType::Integer, false),
+        ColumnDefinition("name", ColumnType::String, false),
+        ColumnDefinition("email", ColumnType::String, true),
+        ColumnDefinition("age", ColumnType::Integer, true)
+    };
+    auto table = TableFactory::create_table("columnar_table", columns, StorageEngine::ColumnStore);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table->storage_engine(), StorageEngine::ColumnStore);
+    EXPECT_TRUE(table->empty());
+
+    auto row_id = table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+    EXPECT_EQ(table->get_row_count(), 2);
+
+    auto row = table->get_row(row_id);
+    ASSERT_TRUE(row.has_value());
+    EXPECT_EQ(std::get<std::string>(row->get_value("name")), "Alice");
+    EXPECT_EQ(std::get<std::int64_t>(row->get_value("age")), 25);
+
+    // Update and verify the new values come back from the column store
+    EXPECT_TRUE(table->update_row(row_id, {{"age", static_cast<std::int64_t>(26)}}));
+    auto updated_row = table->get_row(row_id);
+    ASSERT_TRUE(updated_row.has_value());
+    EXPECT_EQ(std::get<std::int64_t>(updated_row->get_value("age")), 26);
+    EXPECT_EQ(std::get<std::string>(updated_row->get_value("name")), "Alice");
+
+    // Delete and verify slot removal
+    EXPECT_TRUE(table->delete_row(row_id));
+    EXPECT_FALSE(table->get_row(row_id).has_value());
+    EXPECT_EQ(table->get_row_count(), 1);
+}
+
+TEST_F(TableTest, ColumnarTableQueries) {
+    auto table = std::make_unique<Table>(
+        std::make_unique<TableSchema>(*schema_), StorageEngine::ColumnStore);
+
+    table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+    table->insert_row(createSampleRow(3, "Charlie", "charlie@example.com", 35));
+    table->insert_row(createSampleRow(4, "David", "david@example.com", 28));
+
+    // Columnar scan with a typed predicate
+    TableQuery age_query;
+    age_query.where("age", QueryOperator::GreaterThan, static_cast<std::int64_t>(28));
+    auto age_results = table->query(age_query);
+    EXPECT_EQ(age_results.size(), 2); // Bob and Charlie
+
+    // Ordering and limits still apply after the scan
+    TableQuery complex_query;
+    complex_query.where("age", QueryOperator::GreaterThanOrEqual, static_cast<std::int64_t>(28))
+                 .order_by("age", true)
+                 .limit(2);
+    auto results = table->query(complex_query);
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(std::get<std::int64_t>(results[0].get_value("age")), 28); // David
+    EXPECT_EQ(std::get<std::int64_t>(results[1].get_value("age")), 30); // Bob
+
+    // String predicates fall back to the generic comparison path
+    TableQuery name_query;
+    name_query.where("name", QueryOperator::Equal, std::string("Bob"));
+    auto name_results = table->query(name_query);
+    ASSERT_EQ(name_results.size(), 1);
+    EXPECT_EQ(std::get<std::string>(name_results[0].get_value("name")), "Bob");
+
+    // Indexed lookups materialize rows from the column store
+    table->create_index("idx_name", {"name"});
+    auto indexed = table->find_by_index("idx_name", {std::string("Charlie")});
+    ASSERT_EQ(indexed.size(), 1);
+    EXPECT_EQ(std::get<std::int64_t>(indexed[0].get_value("age")), 35);
+}
+
+TEST_F(TableTest, ColumnarTableCloneAndClear) {
+    auto table = std::make_unique<Table>(
+        std::make_unique<TableSchema>(*schema_), StorageEngine::ColumnStore);
+
+    table->insert_row(createSampleRow(1, "Alice", "alice@example.com", 25));
+    table->insert_row(createSampleRow(2, "Bob", "bob@example.com", 30));
+
+    auto cloned = table->clone();
+    ASSERT_NE(cloned, nullptr);
+    EXPECT_EQ(cloned->storage_engine(), StorageEngine::ColumnStore);
+    EXPECT_EQ(cloned->get_row_count(), 2);
+
+    table->clear();
+    EXPECT_TRUE(table->empty());
+    EXPECT_EQ(cloned->get_row_count(), 2); // Clone is independent
+
+    auto all_rows = cloned->get_all_rows();
+    EXPECT_EQ(all_rows.size(), 2);
+}
+
 // Main test suite setup
 class TableTestSuite : public ::testing::Environment {
 public:
@@ -0,0 +1,160 @@
+/*
+ * @file test_timer_wheel.cpp
+ * @brief Unit tests for the hashed timer wheel
+ *
+ * Copyright (c) 2025 Gobind Prasad <gobdeveloper@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include "timer_wheel.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace base;
+using namespace std::chrono_literals;
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+    // Run the io_context until the predicate holds or the deadline passes
+    template<typename Predicate>
+    void run_until(Predicate pred, std::chrono::milliseconds deadline = 2000ms) {
+        auto start = std::chrono::steady_clock::now();
+        while (!pred() && std::chrono::steady_clock::now() - start < deadline) {
+            io_context_.run_for(10ms);
+        }
+    }
+
+    asio::io_context io_context_;
+};
+
+TEST_F(TimerWheelTest, OneShotTimerFires) {
+    TimerWheel wheel(io_context_, 5ms);
+
+    std::atomic<int> fired{0};
+    auto id = wheel.schedule_once(10ms, [&fired]() { fired++; });
+    EXPECT_NE(id, 0u);
+    EXPECT_EQ(wheel.active_timer_count(), 1u);
+
+    run_until([&fired]() { return fired.load() == 1; });
+
+    EXPECT_EQ(fired.load(), 1);
+    EXPECT_EQ(wheel.active_timer_count(), 0u);
+}
+
+TEST_F(TimerWheelTest, RecurringTimerFiresRepeatedly) {
+    TimerWheel wheel(io_context_, 5ms);
+
+    std::atomic<int> fired{0};
+    auto id = wheel.schedule_recurring(10ms, [&fired]() { fired++; });
+
+    run_until([&fired]() { return fired.load() >= 3; });
+
+    EXPECT_GE(fired.load(), 3);
+    EXPECT_EQ(wheel.active_timer_count(), 1u);
+    EXPECT_TRUE(wheel.cancel(id));
+}
+
+TEST_F(TimerWheelTest, CancelPreventsExecution) {
+    TimerWheel wheel(io_context_, 5ms);
+
+    std::atomic<int> fired{0};
+    auto id = wheel.schedule_once(50ms, [&fired]() { fired++; });
+    std::atomic<int> sentinel{0};
+    wheel.schedule_once(100ms, [&sentinel]() { sentinel++; });
+
+    EXPECT_TRUE(wheel.cancel(id));
+    EXPECT_FALSE(wheel.cancel(id));  // Already cancelled
+
+    run_until([&sentinel]() { return sentinel.load() == 1; });
+
+    EXPECT_EQ(fired.load(), 0);
+    EXPECT_EQ(sentinel.load(), 1);
+}
+
+TEST_F(TimerWheelTest, ManyTimersShareOneDriver) {
+    TimerWheel wheel(io_context_, 5ms);
+
+    constexpr int timer_count = 1000;
+    std::atomic<int> fired{0};
+    for (int i = 0; i < timer_count; ++i) {
+        wheel.schedule_once(std::chrono::milliseconds(10 + (i % 50)),
+                            [&fired]() { fired++; });
+    }
+    EXPECT_EQ(wheel.active_timer_count(), static_cast<std::size_t>(timer_count));
+
+    run_until([&fired]() { return fired.load() == timer_count; });
+
+    EXPECT_EQ(fired.load(), timer_count);
+    EXPECT_EQ(wheel.active_timer_count(), 0u);
+}
+
+TEST_F(TimerWheelTest, CancelAllStopsPendingTimers) {
+    TimerWheel wheel(io_context_, 5ms);
+
+    std::atomic<int> fired{0};
+    wheel.schedule_once(20ms, [&fired]() { fired++; });
+    wheel.schedule_recurring(20ms, [&fired]() { fired++; });
+
+    wheel.cancel_all();
+    EXPECT_EQ(wheel.active_timer_count(), 0u);
+
+    io_context_.run_for(100ms);
+    EXPECT_EQ(fired.load(), 0);
+}
+
+TEST_F(TimerWheelTest, IdleWheelDoesNotFireNewTimerEarly) {
+    TimerWheel wheel(io_context_, 5ms);
+
+    // Let wall clock run well past the delay we are about to request
+    // while the wheel sits idle with its driver unarmed
+    std::this_thread::sleep_for(100ms);
+
+    std::atomic<int> fired{0};
+    auto scheduled_at = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point fired_at{};
+    wheel.schedule_once(50ms, [&fired, &fired_at]() {
+        fired_at = std::chrono::steady_clock::now();
+        fired++;
+    });
+
+    // The stale tick would make the timer due immediately; it must not
+    // fire before its delay has actually elapsed
+    io_context_.run_for(20ms);
+    EXPECT_EQ(fired.load(), 0);
+
+    run_until([&fired]() { return fired.load() == 1; });
+    ASSERT_EQ(fired.load(), 1);
+    EXPECT_GE(fired_at - scheduled_at, 45ms);
+}
+
+TEST_F(TimerWheelTest, DrainedWheelDoesNotFireNewTimerEarly) {
+    TimerWheel wheel(io_context_, 5ms);
+
+    std::atomic<int> fired{0};
+    wheel.schedule_once(10ms, [&fired]() { fired++; });
+    run_until([&fired]() { return fired.load() == 1; });
+    ASSERT_EQ(wheel.active_timer_count(), 0u);
+
+    // Idle again after draining; the driver is unarmed and the tick
+    // counter frozen. The io_context stopped when its work ran out, so
+    // restart it for the second round
+    std::this_thread::sleep_for(100ms);
+    io_context_.restart();
+
+    auto scheduled_at = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point fired_at{};
+    wheel.schedule_once(50ms, [&fired, &fired_at]() {
+        fired_at = std::chrono::steady_clock::now();
+        fired++;
+    });
+
+    io_context_.run_for(20ms);
+    EXPECT_EQ(fired.load(), 1);
+
+    run_until([&fired]() { return fired.load() == 2; });
+    ASSERT_EQ(fired.load(), 2);
+    EXPECT_GE(fired_at - scheduled_at, 45ms);
+}